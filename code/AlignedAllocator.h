@@ -0,0 +1,77 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Minimal std::allocator replacement that returns memory aligned to a fixed
+boundary (C++14 operator new does not honour over-aligned types). Used for the
+structure-of-arrays swarm storage so every array starts on a cache line.
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#if defined(_MSC_VER)
+#include <malloc.h>
+#endif
+
+// Cache line size assumed throughout the physics core
+const size_t kCacheLineBytes = 64;
+
+template <typename T, size_t Alignment = kCacheLineBytes>
+class AlignedAllocator
+{
+    public:
+        using value_type = T;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = AlignedAllocator<U, Alignment>;
+        };
+
+        AlignedAllocator() noexcept {}
+
+        template <typename U>
+        AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+        T* allocate(size_t count)
+        {
+            if (count == 0)
+            {
+                return nullptr;
+            }
+            void* memory = nullptr;
+#if defined(_MSC_VER)
+            memory = _aligned_malloc(count * sizeof(T), Alignment);
+#else
+            if (posix_memalign(&memory, Alignment, count * sizeof(T)) != 0)
+            {
+                memory = nullptr;
+            }
+#endif
+            if (memory == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+            return static_cast<T*>(memory);
+        }
+
+        void deallocate(T* pointer, size_t) noexcept
+        {
+#if defined(_MSC_VER)
+            _aligned_free(pointer);
+#else
+            free(pointer);
+#endif
+        }
+};
+
+template <typename T, typename U, size_t Alignment>
+bool operator==(const AlignedAllocator<T, Alignment>&, const AlignedAllocator<U, Alignment>&) { return true; }
+
+template <typename T, typename U, size_t Alignment>
+bool operator!=(const AlignedAllocator<T, Alignment>&, const AlignedAllocator<U, Alignment>&) { return false; }
@@ -0,0 +1,113 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Brute-force and spatial-hash broadphase backends and the backend factory.
+*/
+
+#include "Broadphase.h"
+#include <algorithm>
+#include "BulletBroadphase.h"
+
+void BruteForceBroadphase::findPairs(const SwarmState& state, double triggerDistance,
+                                     std::vector<CollisionPair>& pairs)
+{
+    pairs.clear();
+    const size_t count = state.size();
+    const double triggerSq = triggerDistance * triggerDistance;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        for (size_t j = i + 1; j < count; ++j)
+        {
+            // Two sleeping UAVs have not moved since neither was in contact
+            if (state.asleep[i] && state.asleep[j])
+            {
+                continue;
+            }
+            double dx = state.px[i] - state.px[j];
+            double dy = state.py[i] - state.py[j];
+            double dz = state.pz[i] - state.pz[j];
+            if (dx * dx + dy * dy + dz * dz < triggerSq)
+            {
+                pairs.push_back({static_cast<uint32_t>(i), static_cast<uint32_t>(j)});
+            }
+        }
+    }
+}
+
+void SpatialHashBroadphase::findPairs(const SwarmState& state, double triggerDistance,
+                                      std::vector<CollisionPair>& pairs)
+{
+    pairs.clear();
+
+    // One cell spans the trigger distance, so any colliding pair is at most one cell apart
+    grid.setCellSize(triggerDistance);
+    grid.rebuild(state.px.data(), state.py.data(), state.pz.data(), state.size());
+
+    // Only awake UAVs query; a pair with a sleeping UAV is seen from the awake side only
+    for (size_t i = 0; i < state.size(); ++i)
+    {
+        if (state.asleep[i])
+        {
+            continue;
+        }
+        grid.forEachNeighbour(i, [&](size_t j)
+        {
+            if (state.asleep[j])
+            {
+                pairs.push_back({static_cast<uint32_t>(std::min(i, j)), static_cast<uint32_t>(std::max(i, j))});
+            }
+            else if (i < j)
+            {
+                // Each awake pair is seen from both sides; keep the visit from the lower id
+                pairs.push_back({static_cast<uint32_t>(i), static_cast<uint32_t>(j)});
+            }
+        });
+    }
+}
+
+std::unique_ptr<Broadphase> createBroadphase(BroadphaseType type)
+{
+    switch (type)
+    {
+        case BroadphaseType::BRUTE_FORCE:
+            return std::unique_ptr<Broadphase>(new BruteForceBroadphase());
+        case BroadphaseType::BULLET_DBVT:
+            return std::unique_ptr<Broadphase>(new BulletDbvtBroadphase());
+        case BroadphaseType::BULLET_SWEEP:
+            return std::unique_ptr<Broadphase>(new BulletSweepBroadphase());
+        case BroadphaseType::SPATIAL_HASH:
+        default:
+            return std::unique_ptr<Broadphase>(new SpatialHashBroadphase());
+    }
+}
+
+bool parseBroadphaseType(const std::string& name, BroadphaseType& type)
+{
+    const BroadphaseType types[] = {BroadphaseType::BRUTE_FORCE, BroadphaseType::SPATIAL_HASH,
+                                    BroadphaseType::BULLET_DBVT, BroadphaseType::BULLET_SWEEP};
+    for (BroadphaseType candidate : types)
+    {
+        if (name == getBroadphaseTypeName(candidate))
+        {
+            type = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* getBroadphaseTypeName(BroadphaseType type)
+{
+    switch (type)
+    {
+        case BroadphaseType::BRUTE_FORCE:  return "brute";
+        case BroadphaseType::BULLET_DBVT:  return "dbvt";
+        case BroadphaseType::BULLET_SWEEP: return "sweep";
+        case BroadphaseType::SPATIAL_HASH:
+        default:                           return "grid";
+    }
+}
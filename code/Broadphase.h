@@ -0,0 +1,96 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Abstract collision broadphase. A backend receives the swarm positions once per
+tick and reports every pair of UAVs whose bounding volumes may overlap into a
+shared pair list; the narrowphase in PhysicsGlobals then tests and resolves
+those pairs. Backends: the original brute-force loop, the uniform-grid spatial
+hash, and adapters for Bullet's DBVT and axis-sweep (sweep-and-prune)
+broadphases.
+*/
+
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "SpatialHashGrid.h"
+#include "SwarmState.h"
+
+// Candidate pair of UAV ids, always stored with a < b
+struct CollisionPair
+{
+    uint32_t a;
+    uint32_t b;
+};
+
+enum class BroadphaseType
+{
+    BRUTE_FORCE,    // All pairs, O(N^2)
+    SPATIAL_HASH,   // Uniform grid, 27-cell neighbourhood (default)
+    BULLET_DBVT,    // Bullet btDbvtBroadphase (dynamic AABB tree)
+    BULLET_SWEEP    // Bullet bt32BitAxisSweep3 (sweep-and-prune)
+};
+
+class Broadphase
+{
+    public:
+        virtual ~Broadphase() {}
+
+        // Short backend name for logs and command lines
+        virtual const char* getName() const = 0;
+
+        /*
+        Find candidate pairs for the current positions
+        Input:
+            - state: Swarm positions (item id == array index)
+            - triggerDistance: Centre distance below which two UAVs collide
+            - pairs: Output list, cleared first; pairs are unique with a < b
+        Pairs of two sleeping UAVs (state.asleep) are left out.
+        */
+        virtual void findPairs(const SwarmState& state, double triggerDistance,
+                               std::vector<CollisionPair>& pairs) = 0;
+};
+
+// Original all-pairs loop, reporting pairs within the trigger distance
+class BruteForceBroadphase : public Broadphase
+{
+    public:
+        const char* getName() const override { return "brute"; }
+        void findPairs(const SwarmState& state, double triggerDistance,
+                       std::vector<CollisionPair>& pairs) override;
+};
+
+// Uniform-grid spatial hash with cells one trigger distance wide
+class SpatialHashBroadphase : public Broadphase
+{
+    public:
+        const char* getName() const override { return "grid"; }
+        void findPairs(const SwarmState& state, double triggerDistance,
+                       std::vector<CollisionPair>& pairs) override;
+
+    private:
+        SpatialHashGrid grid;
+};
+
+/*
+Create a broadphase backend
+Input: type - backend to create
+Output: Owning pointer to the backend
+*/
+std::unique_ptr<Broadphase> createBroadphase(BroadphaseType type);
+
+/*
+Parse a backend name ("brute", "grid", "dbvt", "sweep")
+Input:
+    - name: Backend name
+    - type: Set to the parsed backend on success
+Output: true if the name is known
+*/
+bool parseBroadphaseType(const std::string& name, BroadphaseType& type);
+
+// Name of a backend type, inverse of parseBroadphaseType
+const char* getBroadphaseTypeName(BroadphaseType type);
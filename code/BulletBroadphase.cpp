@@ -0,0 +1,149 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Implementation of the Bullet DBVT and axis-sweep broadphase adapters.
+*/
+
+#include "BulletBroadphase.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include "BulletCollision/BroadphaseCollision/btAxisSweep3.h"
+#include "BulletCollision/BroadphaseCollision/btDbvtBroadphase.h"
+#include "BulletCollision/BroadphaseCollision/btOverlappingPairCache.h"
+
+namespace
+{
+    // Quantisation bounds for the sweep-and-prune axes (meters). UAVs outside
+    // are clamped to the border, which only makes the broadphase conservative.
+    const btVector3 kWorldAabbMin(-2048.0f, -2048.0f, -256.0f);
+    const btVector3 kWorldAabbMax(2048.0f, 2048.0f, 2048.0f);
+
+    // Widen the float AABBs slightly so rounding never drops a real contact
+    const double kAabbSlop = 1e-3;
+
+    void* idToUserPointer(size_t id)
+    {
+        return reinterpret_cast<void*>(static_cast<uintptr_t>(id));
+    }
+
+    uint32_t userPointerToId(const btBroadphaseProxy* proxy)
+    {
+        return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(proxy->m_clientObject));
+    }
+}
+
+BulletBroadphaseAdapter::BulletBroadphaseAdapter()
+{
+}
+
+BulletBroadphaseAdapter::~BulletBroadphaseAdapter()
+{
+    destroyBroadphase();
+}
+
+void BulletBroadphaseAdapter::destroyBroadphase()
+{
+    if (broadphase)
+    {
+        for (btBroadphaseProxy* proxy : proxies)
+        {
+            broadphase->destroyProxy(proxy, nullptr);
+        }
+    }
+    proxies.clear();
+    broadphase.reset();
+}
+
+/*
+Refresh every proxy AABB, let Bullet update its pair cache, copy the pairs out
+*/
+void BulletBroadphaseAdapter::findPairs(const SwarmState& state, double triggerDistance,
+                                        std::vector<CollisionPair>& pairs)
+{
+    pairs.clear();
+    const size_t count = state.size();
+
+    // (Re)create the broadphase when the fleet outgrows it
+    if (!broadphase || count > getProxyCapacity())
+    {
+        destroyBroadphase();
+        broadphase.reset(createBulletBroadphase(std::max<size_t>(count, 1024)));
+    }
+
+    // Boxes of edge triggerDistance overlap whenever the spheres could touch
+    const btScalar halfExtent = static_cast<btScalar>(0.5 * triggerDistance + kAabbSlop);
+    const btVector3 extent(halfExtent, halfExtent, halfExtent);
+
+    // Drop proxies of UAVs that no longer exist
+    while (proxies.size() > count)
+    {
+        broadphase->destroyProxy(proxies.back(), nullptr);
+        proxies.pop_back();
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const btVector3 center(static_cast<btScalar>(state.px[i]),
+                               static_cast<btScalar>(state.py[i]),
+                               static_cast<btScalar>(state.pz[i]));
+        const btVector3 aabbMin = center - extent;
+        const btVector3 aabbMax = center + extent;
+
+        if (i < proxies.size())
+        {
+            broadphase->setAabb(proxies[i], aabbMin, aabbMax, nullptr);
+        }
+        else
+        {
+            // No dispatcher is needed: pairs never get a collision algorithm attached
+            proxies.push_back(broadphase->createProxy(aabbMin, aabbMax, SPHERE_SHAPE_PROXYTYPE,
+                                                      idToUserPointer(i),
+                                                      btBroadphaseProxy::DefaultFilter,
+                                                      btBroadphaseProxy::AllFilter,
+                                                      nullptr, nullptr));
+        }
+    }
+
+    broadphase->calculateOverlappingPairs(nullptr);
+
+    btBroadphasePairArray& bulletPairs = broadphase->getOverlappingPairCache()->getOverlappingPairArray();
+    pairs.reserve(bulletPairs.size());
+    for (int k = 0; k < bulletPairs.size(); ++k)
+    {
+        uint32_t a = userPointerToId(bulletPairs[k].m_pProxy0);
+        uint32_t b = userPointerToId(bulletPairs[k].m_pProxy1);
+        if (a == b || (state.asleep[a] && state.asleep[b]))
+        {
+            continue;
+        }
+        pairs.push_back({std::min(a, b), std::max(a, b)});
+    }
+
+    // Bullet's pair cache order depends on its hashing; report pairs in id order
+    std::sort(pairs.begin(), pairs.end(), [](const CollisionPair& lhs, const CollisionPair& rhs)
+    {
+        return lhs.a != rhs.a ? lhs.a < rhs.a : lhs.b < rhs.b;
+    });
+}
+
+btBroadphaseInterface* BulletDbvtBroadphase::createBulletBroadphase(size_t)
+{
+    return new btDbvtBroadphase();
+}
+
+size_t BulletDbvtBroadphase::getProxyCapacity() const
+{
+    return std::numeric_limits<size_t>::max();
+}
+
+btBroadphaseInterface* BulletSweepBroadphase::createBulletBroadphase(size_t capacity)
+{
+    // Bullet reserves handle 0 as a sentinel
+    handleCapacity = capacity;
+    return new bt32BitAxisSweep3(kWorldAabbMin, kWorldAabbMax,
+                                 static_cast<unsigned int>(capacity + 1), nullptr, true);
+}
@@ -0,0 +1,73 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Broadphase adapters over the vendored Bullet 2.81 collision library. Every UAV
+is a Bullet proxy whose AABB is refreshed each tick; Bullet's overlapping pair
+cache is then copied into the shared pair list. Only the broadphase part of
+Bullet is used, no collision dispatcher or narrowphase algorithms.
+*/
+
+#pragma once
+#include <memory>
+#include <vector>
+#include "Broadphase.h"
+
+class btBroadphaseInterface;
+struct btBroadphaseProxy;
+
+// Shared proxy bookkeeping for the Bullet backends
+class BulletBroadphaseAdapter : public Broadphase
+{
+    public:
+        ~BulletBroadphaseAdapter() override;
+
+        void findPairs(const SwarmState& state, double triggerDistance,
+                       std::vector<CollisionPair>& pairs) override;
+
+    protected:
+        BulletBroadphaseAdapter();
+
+        /*
+        Create the Bullet broadphase
+        Input: capacity - number of proxies it must hold
+        */
+        virtual btBroadphaseInterface* createBulletBroadphase(size_t capacity) = 0;
+
+        // Largest proxy count the current broadphase accepts
+        virtual size_t getProxyCapacity() const = 0;
+
+        // Remove all proxies and drop the Bullet broadphase
+        void destroyBroadphase();
+
+        std::unique_ptr<btBroadphaseInterface> broadphase;
+        std::vector<btBroadphaseProxy*> proxies;
+};
+
+// Dynamic AABB tree (btDbvtBroadphase), no fixed world bounds
+class BulletDbvtBroadphase : public BulletBroadphaseAdapter
+{
+    public:
+        const char* getName() const override { return "dbvt"; }
+
+    protected:
+        btBroadphaseInterface* createBulletBroadphase(size_t capacity) override;
+        size_t getProxyCapacity() const override;
+};
+
+// Sweep-and-prune on quantised world bounds (bt32BitAxisSweep3)
+class BulletSweepBroadphase : public BulletBroadphaseAdapter
+{
+    public:
+        BulletSweepBroadphase() : handleCapacity(0) {}
+        const char* getName() const override { return "sweep"; }
+
+    protected:
+        btBroadphaseInterface* createBulletBroadphase(size_t capacity) override;
+        size_t getProxyCapacity() const override { return handleCapacity; }
+
+    private:
+        size_t handleCapacity;
+};
@@ -0,0 +1,96 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Implementation of the greedy contact colouring.
+*/
+
+#include "ContactColoring.h"
+#include <algorithm>
+
+namespace
+{
+    // Index of the lowest set bit (mask != 0)
+    size_t lowestSetBit(uint64_t mask)
+    {
+        size_t bit = 0;
+        while ((mask & 1) == 0)
+        {
+            mask >>= 1;
+            ++bit;
+        }
+        return bit;
+    }
+}
+
+ContactColoring::ContactColoring()
+    : colorOffsets(1, 0)
+{
+}
+
+/*
+Greedy colouring in (a, b) order, then a stable counting sort by colour
+*/
+void ContactColoring::build(std::vector<CollisionPair>& contacts, size_t bodyCount)
+{
+    // A fixed order makes the colouring independent of the broadphase backend
+    std::sort(contacts.begin(), contacts.end(), [](const CollisionPair& lhs, const CollisionPair& rhs)
+    {
+        return lhs.a != rhs.a ? lhs.a < rhs.a : lhs.b < rhs.b;
+    });
+
+    // Masks are all zero between builds, only resize when the fleet changes
+    usedColors.resize(bodyCount, 0);
+    contactColors.resize(contacts.size());
+
+    // Colour sizes for colours 0..kMaxColors-1 and the serial group
+    size_t counts[kMaxColors + 1] = {};
+    size_t colorCount = 0;
+
+    for (size_t k = 0; k < contacts.size(); ++k)
+    {
+        const CollisionPair& contact = contacts[k];
+        const uint64_t availableColors = ~(usedColors[contact.a] | usedColors[contact.b]);
+
+        size_t color = kMaxColors;
+        if (availableColors != 0)
+        {
+            // Smallest colour used by neither UAV
+            color = lowestSetBit(availableColors);
+            const uint64_t bit = uint64_t(1) << color;
+            usedColors[contact.a] |= bit;
+            usedColors[contact.b] |= bit;
+            colorCount = std::max(colorCount, color + 1);
+        }
+
+        contactColors[k] = static_cast<uint8_t>(color);
+        counts[color]++;
+    }
+
+    // Offsets of the colours, the serial group goes last
+    colorOffsets.assign(colorCount + 1, 0);
+    for (size_t color = 1; color <= colorCount; ++color)
+    {
+        colorOffsets[color] = colorOffsets[color - 1] + counts[color - 1];
+    }
+
+    // Stable scatter keeps (a, b) order inside every colour
+    // (the serial group starts at colorOffsets[colorCount])
+    colorCursor.assign(colorOffsets.begin(), colorOffsets.end());
+    scratch.resize(contacts.size());
+    for (size_t k = 0; k < contacts.size(); ++k)
+    {
+        const size_t color = contactColors[k] == kMaxColors ? colorCount : contactColors[k];
+        scratch[colorCursor[color]++] = contacts[k];
+    }
+    contacts.swap(scratch);
+
+    // Clear only the masks this tick touched
+    for (const CollisionPair& contact : contacts)
+    {
+        usedColors[contact.a] = 0;
+        usedColors[contact.b] = 0;
+    }
+}
@@ -0,0 +1,63 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Graph colouring of the contacts found in one tick. Contacts are the edges of a
+graph over UAVs; a greedy colouring in (a, b) order puts contacts that share a
+UAV into different colours. Every colour batch can then be resolved in
+parallel without locks, one colour after another, and the result is the same
+as resolving the colours sequentially, independent of thread count or timing.
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Broadphase.h"
+
+class ContactColoring
+{
+    public:
+        // Colours tracked per UAV in one 64-bit mask
+        static const size_t kMaxColors = 64;
+
+        ContactColoring();
+
+        /*
+        Sort the contacts by (a, b) and group them by colour
+        Input:
+            - contacts: Contacts of this tick, reordered in place so that each
+              colour is contiguous, followed by the serial overflow group
+            - bodyCount: Number of UAVs (every id < bodyCount)
+        */
+        void build(std::vector<CollisionPair>& contacts, size_t bodyCount);
+
+        // Number of lock-free colour batches
+        size_t getColorCount() const { return colorOffsets.size() - 1; }
+
+        // Contacts [getColorBegin(c), getColorEnd(c)) share no UAV
+        size_t getColorBegin(size_t color) const { return colorOffsets[color]; }
+        size_t getColorEnd(size_t color) const { return colorOffsets[color + 1]; }
+
+        /*
+        Contacts left over when a UAV touches more than kMaxColors others;
+        [getSerialBegin(), contacts.size()) must be resolved in order on one thread
+        */
+        size_t getSerialBegin() const { return colorOffsets.back(); }
+
+    private:
+        // Colours already used by each UAV's contacts (bit c = colour c)
+        std::vector<uint64_t> usedColors;
+
+        // Colour of every contact in sorted order, kMaxColors for the serial group
+        std::vector<uint8_t> contactColors;
+
+        // Prefix sums of the colour sizes, getColorCount() + 1 entries
+        std::vector<size_t> colorOffsets;
+
+        // Scatter state for the stable sort by colour
+        std::vector<size_t> colorCursor;
+        std::vector<CollisionPair> scratch;
+};
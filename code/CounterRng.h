@@ -0,0 +1,81 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Counter-based random numbers (Philox4x32-10, Salmon et al., SC'11). A draw is
+a pure function of a 128-bit counter and a 64-bit key, so every UAV can
+evaluate its own numbers from (seed, UAV id, tick) without shared generator
+state, locks or ordering between threads. The rounds are branch-free 32-bit
+integer operations, so loops over UAV ids can also be vectorised.
+*/
+
+#pragma once
+#include <cstdint>
+
+// 128 bits of Philox output (or input counter)
+struct PhiloxBlock
+{
+    uint32_t word[4];
+};
+
+namespace philox_detail
+{
+    const uint32_t kMultiplier0 = 0xD2511F53u;
+    const uint32_t kMultiplier1 = 0xCD9E8D57u;
+    const uint32_t kWeyl0 = 0x9E3779B9u;
+    const uint32_t kWeyl1 = 0xBB67AE85u;
+
+    inline void mulhilo(uint32_t a, uint32_t b, uint32_t& hi, uint32_t& lo)
+    {
+        const uint64_t product = static_cast<uint64_t>(a) * b;
+        hi = static_cast<uint32_t>(product >> 32);
+        lo = static_cast<uint32_t>(product);
+    }
+}
+
+/*
+Philox4x32 with 10 rounds
+Input:
+    - counter: Position in the stream, e.g. {tick low, tick high, UAV id, draw}
+    - key0, key1: 64-bit key, e.g. the simulation seed
+Output: 128 random bits, identical for identical inputs on every platform
+*/
+inline PhiloxBlock philox4x32(PhiloxBlock counter, uint32_t key0, uint32_t key1)
+{
+    for (int round = 0; round < 10; ++round)
+    {
+        uint32_t hi0, lo0, hi1, lo1;
+        philox_detail::mulhilo(philox_detail::kMultiplier0, counter.word[0], hi0, lo0);
+        philox_detail::mulhilo(philox_detail::kMultiplier1, counter.word[2], hi1, lo1);
+
+        const PhiloxBlock next = {{hi1 ^ counter.word[1] ^ key0, lo1,
+                                   hi0 ^ counter.word[3] ^ key1, lo0}};
+        counter = next;
+
+        key0 += philox_detail::kWeyl0;
+        key1 += philox_detail::kWeyl1;
+    }
+    return counter;
+}
+
+/*
+Random bits for one (seed, id, tick, draw) tuple
+Input:
+    - seed: Simulation seed
+    - id: UAV id
+    - tick: Simulation tick
+    - draw: Index of the draw by this UAV, so repeated draws differ
+*/
+inline PhiloxBlock counterRandom(uint64_t seed, uint32_t id, uint64_t tick, uint32_t draw)
+{
+    const PhiloxBlock counter = {{static_cast<uint32_t>(tick), static_cast<uint32_t>(tick >> 32), id, draw}};
+    return philox4x32(counter, static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32));
+}
+
+// Map 32 random bits to a double uniformly spaced in [-1, 1)
+inline double toSignedUnit(uint32_t bits)
+{
+    return bits * (1.0 / 2147483648.0) - 1.0;
+}
@@ -1,7 +1,7 @@
 /*
 Author: Aaron Huang, Dulani Wijayarathne, Matt Chung
 Class: ECE6122
-Last Date Modified: November 29, 2025
+Last Date Modified: October 16, 2026
 
 Description:
 ECE_UAV class implementation for UAV simulation, including physics updates and control.
@@ -9,103 +9,60 @@ ECE_UAV class implementation for UAV simulation, including physics updates and c
 */
 
 #pragma once
-#include <thread>
-#include <atomic>
+#include <cstdint>
 #include <mutex>
-#include <chrono>
+#include "AlignedAllocator.h"
 #include "Vec3.h"
+#include "SwarmState.h"
 #include "PhysicsGlobals.h"
-#include "PIDController.h"
-
-// Flight state enumeration for state machine
-enum class FlightState 
-{
-    IDLE,       // 0-5 seconds: Remain on ground
-    ASCENT,     // Launch phase: Fly to (0,0,50) with max velocity 2 m/s
-    ORBIT,      // Orbit phase: Fly on sphere surface for 60 seconds
-    RETURN,     // Descend and travel back to launch position
-    FINISHED    // Simulation complete
-};
+#include "SimClock.h"
+#include "FlightController.h"
 
 class ECE_UAV 
 {
     private:
-        // Declare kinematic variables
-        Vec3 position;
-        Vec3 velocity;
-        Vec3 acceleration;
+        // Kinematic variables live in the shared structure-of-arrays store
+        SwarmState& state;
+        size_t id;
+
+        // Simulated time source shared by the fleet
+        const SimClock& clock;
 
-    // Home pad for return-to-start requirement
-    Vec3 homePosition;
-        
         // Mass of UAV (1 kg)
         double mass; // kg
 
-        // Max force the UAV can exert
-        double maxForce = 20.0; // Newtons
-
         // Gravity compensation force
         double gravityCompensation;
 
-        // Control parameters
-        Vec3 controlForce;
-
-        // Thread for kinematic updates
-        std::thread uavThread;
-        
-        // Flag to control thread execution
-        std::atomic<bool> running;
-
-        // Mutex for thread-safe access to kinematic data
-        mutable std::mutex dataMutex;
-        
-        // ===== PERSON 3: FLIGHT CONTROL STATE MACHINE =====
-        // Current flight state
-        FlightState currentState;
-        
-        // Timing variables
-        std::chrono::steady_clock::time_point startTime;
-        std::chrono::steady_clock::time_point orbitStartTime;
-        
-        // PID controllers for sphere orbit (one per axis)
-        PIDController pidX;
-        PIDController pidY;
-        PIDController pidZ;
-        
-        // Target point for ascent phase
-        Vec3 targetPoint;
-        
-        // Sphere center and radius for orbit phase
-        Vec3 sphereCenter;
-        double sphereRadius;
-        
-        // Random velocity direction for orbit
-        Vec3 randomDirection;
-        
-        // Color oscillation (ECE6122 requirement)
-        double colorPhase;
+        // Mutex for thread-safe access to kinematic data. Locking writes its
+        // line, so it gets a cache line of its own: the fields above are read
+        // by the physics workers while other threads take the lock.
+        alignas(kCacheLineBytes) mutable std::mutex dataMutex;
 
-        // Flag to indicate completion of the 60-second orbit window
-        bool orbitCompleted;
+        // Flight state, timing, orbit direction and colour phase live in the
+        // SwarmState control arrays and are advanced by FlightController
 
+        // Orbit controller gains and flight start time of a new flight
+        void startFlight();
     public:
         /*
         **************************
-        CONSTRUCTOR / DESTRUCTOR & THREAD CONTROL
+        CONSTRUCTOR / DESTRUCTOR
         **************************
         */
         //Declare member functions
-        ECE_UAV(Vec3 initial_pos);
+        // Registers the UAV in the given state store at initial_pos; the
+        // flight timeline runs on simClock, which must outlive the UAV.
+        // The class is cache-line aligned: create fleets in a UavArena.
+        ECE_UAV(SwarmState& swarmState, const SimClock& simClock, Vec3 initial_pos);
         ~ECE_UAV();
 
-        // Start the thread running threadFunction
-        void start();
-        
-        // Stop the thread
-        void stop();
+        // Index of this UAV in the SwarmState arrays
+        size_t getId() const { return id; }
 
-        // Check if thread is running
-        bool isRunning() const { return running; }
+        // Start a new flight from position in this UAV's slot, IDLE at rest
+        // as if just constructed. Only for retired UAVs, between ticks.
+        void relaunch(const Vec3& position);
         
         /*
         **************************
@@ -126,25 +83,15 @@ class ECE_UAV
         PHYSICS UPDATE FUNCTIONS
         **************************
         */
-        // Update kinematics (called by threadFunction)
+        // Update kinematics using the given control force
         void updateKinematics(const Vec3& controlForce, double deltaTime);
-        
-        // Friend function declaration
-        friend void threadFunction(ECE_UAV* pUAV);
 
-        friend void checkCollisionsFor(ECE_UAV* me);
+        // Integrate the stored control force for this UAV only; the stepper
+        // integrates whole batches through SwarmState::integrate instead
+        void applyControlForce(double deltaTime);
 
-        /*
-        **************************
-        CONTROL FUNCTIONS
-        **************************
-        */
-        // Calculate control forces for PID
-        Vec3 calculateControlForces(const Vec3& target, double dt);
+        friend void resolveCollisionPair(ECE_UAV* first, ECE_UAV* second);
 
-        // Reset controllers
-        void resetControllers();
-        
         // ===== PERSON 3: STATE MACHINE CONTROL =====
         /*
         Get current flight state
@@ -153,7 +100,7 @@ class ECE_UAV
         FlightState getFlightState();
         
         /*
-        Get elapsed time since simulation start
+        Get simulated time since this UAV was created
         Output: Time in seconds
         */
         double getElapsedTime();
@@ -166,20 +113,8 @@ class ECE_UAV
 
         // Whether this UAV has satisfied the 60-second orbit requirement
         bool hasCompletedOrbit();
-        
-        /*
-        Calculate control force based on current flight state
-        Input: deltaTime - time step for PID calculations
-        Output: Force vector to apply to UAV
-        */
-        Vec3 calculateStateBasedForce(double deltaTime);
-        
-        /*
-        Generate random direction for orbit phase
-        */
-        void generateRandomDirection();
 
-};
+        // Whether the UAV is out of service, waiting for its slot to be reused
+        bool isRetired() const;
 
-// External thread function
-void threadFunction(ECE_UAV* pUAV);
+};
@@ -0,0 +1,271 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Implementation of the per-thread ring buffers and the background writer of
+the binary event log.
+*/
+
+#include "EventLog.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "AlignedAllocator.h"
+
+namespace
+{
+    // Records per logging thread (power of two, 256 KB per ring)
+    const size_t kRingCapacity = 8192;
+    const size_t kRingMask = kRingCapacity - 1;
+
+    // Writer back-off when every ring is empty
+    const std::chrono::milliseconds kWriterIdle(5);
+
+    // Single-producer / single-consumer ring owned by one logging thread. The
+    // producer and consumer indices sit on separate cache lines.
+    struct EventRing
+    {
+        std::atomic<size_t> head{0};   // Next slot to fill, written by the producer
+        char headPadding[kCacheLineBytes - sizeof(std::atomic<size_t>)];
+
+        std::atomic<size_t> tail{0};   // Next slot to drain, written by the writer thread
+        char tailPadding[kCacheLineBytes - sizeof(std::atomic<size_t>)];
+
+        // Producer-only state
+        size_t cachedTail = 0;
+        uint32_t sampleCounters[static_cast<size_t>(EventCategory::COUNT)] = {};
+
+        // Written only by the producer, read by getEventLogStats
+        std::atomic<unsigned long long> dropped{0};
+        std::atomic<unsigned long long> sampledOut{0};
+
+        EventRecord records[kRingCapacity];
+    };
+
+    std::atomic<bool> gLogOpen(false);
+    std::atomic<uint32_t> gSampling[static_cast<size_t>(EventCategory::COUNT)] = {{1}, {1}, {100}};
+
+    // Bumped by every open so threads re-register their ring
+    std::atomic<unsigned int> gGeneration(0);
+
+    // Rings of the current log, guarded by gRingsMutex
+    std::mutex gRingsMutex;
+    std::vector<std::unique_ptr<EventRing>> gRings;
+
+    FILE* gFile = nullptr;
+    std::thread gWriter;
+    std::atomic<bool> gWriterRunning(false);
+    std::atomic<unsigned long long> gWritten(0);
+    EventLogStats gClosedStats;
+
+    // Flush and join the writer if the program exits with the log still open
+    struct EventLogCloser
+    {
+        ~EventLogCloser() { closeEventLog(); }
+    } gCloser;
+
+    thread_local EventRing* tRing = nullptr;
+    thread_local unsigned int tRingGeneration = 0;
+
+    // This thread's ring for the current log, created on first use
+    EventRing* getThreadRing()
+    {
+        const unsigned int generation = gGeneration.load(std::memory_order_acquire);
+        if (tRing == nullptr || tRingGeneration != generation)
+        {
+            std::lock_guard<std::mutex> lock(gRingsMutex);
+            gRings.emplace_back(new EventRing());
+            tRing = gRings.back().get();
+            tRingGeneration = generation;
+        }
+        return tRing;
+    }
+
+    // Write everything the producer has published, wrapping at the ring end
+    size_t drainRing(EventRing& ring)
+    {
+        const size_t tail = ring.tail.load(std::memory_order_relaxed);
+        const size_t head = ring.head.load(std::memory_order_acquire);
+        const size_t count = head - tail;
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        const size_t first = tail & kRingMask;
+        const size_t firstPart = std::min(count, kRingCapacity - first);
+        fwrite(&ring.records[first], sizeof(EventRecord), firstPart, gFile);
+        fwrite(&ring.records[0], sizeof(EventRecord), count - firstPart, gFile);
+
+        ring.tail.store(head, std::memory_order_release);
+        return count;
+    }
+
+    size_t drainAllRings()
+    {
+        std::lock_guard<std::mutex> lock(gRingsMutex);
+        size_t drained = 0;
+        for (std::unique_ptr<EventRing>& ring : gRings)
+        {
+            drained += drainRing(*ring);
+        }
+        gWritten.fetch_add(drained, std::memory_order_relaxed);
+        return drained;
+    }
+
+    void writerLoop()
+    {
+        while (gWriterRunning.load(std::memory_order_acquire))
+        {
+            if (drainAllRings() == 0)
+            {
+                std::this_thread::sleep_for(kWriterIdle);
+            }
+        }
+    }
+
+    EventLogStats collectStats()
+    {
+        EventLogStats stats;
+        stats.written = gWritten.load(std::memory_order_relaxed);
+        for (std::unique_ptr<EventRing>& ring : gRings)
+        {
+            stats.dropped += ring->dropped.load(std::memory_order_relaxed);
+            stats.sampledOut += ring->sampledOut.load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+}
+
+bool openEventLog(const std::string& path)
+{
+    closeEventLog();
+
+    gFile = fopen(path.c_str(), "wb");
+    if (gFile == nullptr)
+    {
+        return false;
+    }
+
+    EventLogHeader header;
+    std::memcpy(header.magic, kEventLogMagic, sizeof(header.magic));
+    header.version = kEventLogVersion;
+    header.recordSize = sizeof(EventRecord);
+    fwrite(&header, sizeof(header), 1, gFile);
+
+    gWritten.store(0);
+    gGeneration.fetch_add(1, std::memory_order_acq_rel);
+    gWriterRunning = true;
+    gWriter = std::thread(writerLoop);
+    gLogOpen.store(true, std::memory_order_release);
+    return true;
+}
+
+void closeEventLog()
+{
+    if (!gLogOpen.exchange(false))
+    {
+        return;
+    }
+
+    gWriterRunning = false;
+    gWriter.join();
+    drainAllRings();
+
+    std::lock_guard<std::mutex> lock(gRingsMutex);
+    gClosedStats = collectStats();
+    gRings.clear();
+    fclose(gFile);
+    gFile = nullptr;
+}
+
+bool isEventLogOpen()
+{
+    return gLogOpen.load(std::memory_order_acquire);
+}
+
+void setEventSampling(EventCategory category, uint32_t everyN)
+{
+    gSampling[static_cast<size_t>(category)].store(everyN, std::memory_order_relaxed);
+}
+
+EventCategory getEventCategory(EventKind kind)
+{
+    switch (kind)
+    {
+        case EventKind::STATE_TRANSITION:  return EventCategory::STATE;
+        case EventKind::COLLISION:         return EventCategory::COLLISION;
+        case EventKind::ASCENT_DIAGNOSTIC: return EventCategory::DIAGNOSTIC;
+        case EventKind::ORBIT_DIAGNOSTIC:  return EventCategory::DIAGNOSTIC;
+    }
+    return EventCategory::DIAGNOSTIC;
+}
+
+const char* getEventKindName(EventKind kind)
+{
+    switch (kind)
+    {
+        case EventKind::STATE_TRANSITION:  return "state";
+        case EventKind::COLLISION:         return "collision";
+        case EventKind::ASCENT_DIAGNOSTIC: return "ascent";
+        case EventKind::ORBIT_DIAGNOSTIC:  return "orbit";
+    }
+    return "unknown";
+}
+
+void logEvent(EventKind kind, uint64_t tick, uint32_t uav, uint32_t aux,
+              float value0, float value1, float value2)
+{
+    if (!gLogOpen.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    EventRing* ring = getThreadRing();
+
+    // Keep one in everyN events of the category, counted per thread
+    const size_t category = static_cast<size_t>(getEventCategory(kind));
+    const uint32_t everyN = gSampling[category].load(std::memory_order_relaxed);
+    if (everyN == 0 || ring->sampleCounters[category]++ % everyN != 0)
+    {
+        ring->sampledOut.store(ring->sampledOut.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return;
+    }
+
+    // Drop rather than wait when the writer has fallen a full ring behind
+    const size_t head = ring->head.load(std::memory_order_relaxed);
+    if (head - ring->cachedTail >= kRingCapacity)
+    {
+        ring->cachedTail = ring->tail.load(std::memory_order_acquire);
+        if (head - ring->cachedTail >= kRingCapacity)
+        {
+            ring->dropped.store(ring->dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    EventRecord& record = ring->records[head & kRingMask];
+    record.tick = tick;
+    record.uav = uav;
+    record.aux = aux;
+    record.kind = static_cast<uint16_t>(kind);
+    record.reserved = 0;
+    record.values[0] = value0;
+    record.values[1] = value1;
+    record.values[2] = value2;
+    ring->head.store(head + 1, std::memory_order_release);
+}
+
+EventLogStats getEventLogStats()
+{
+    std::lock_guard<std::mutex> lock(gRingsMutex);
+    return isEventLogOpen() ? collectStats() : gClosedStats;
+}
@@ -0,0 +1,102 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Asynchronous binary event log for the physics threads. Each thread that logs
+gets its own lock-free single-producer ring of fixed-size records; a
+background writer thread drains all rings into a binary file. Logging an event
+on a tick thread is a sampling check plus a ring write, never a lock or a
+stream operation, and a full ring drops the record instead of blocking.
+Decode the file with uav_log_decode.
+
+File layout: EventLogHeader, then EventRecords in drain order (records of one
+thread stay in order; use the tick field to merge threads).
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Categories with independent sampling rates
+enum class EventCategory : uint8_t
+{
+    STATE,       // Flight state transitions
+    COLLISION,   // Resolved collisions
+    DIAGNOSTIC,  // Periodic controller diagnostics
+    COUNT
+};
+
+enum class EventKind : uint16_t
+{
+    STATE_TRANSITION,  // aux = (from << 8) | to FlightState, values = position
+    COLLISION,         // uav/aux = pair of ids, values = position of uav
+    ASCENT_DIAGNOSTIC, // values = distance to center, distance from surface, speed
+    ORBIT_DIAGNOSTIC   // values = tangential speed, radial error, radius
+};
+
+// One 32-byte log record
+struct EventRecord
+{
+    uint64_t tick;      // Simulation tick of the event
+    uint32_t uav;       // UAV id
+    uint32_t aux;       // Kind-specific integer payload
+    uint16_t kind;      // EventKind
+    uint16_t reserved;
+    float values[3];    // Kind-specific payload
+};
+
+// Start of every log file
+struct EventLogHeader
+{
+    char magic[8];        // kEventLogMagic
+    uint32_t version;     // kEventLogVersion
+    uint32_t recordSize;  // sizeof(EventRecord)
+};
+
+const char kEventLogMagic[8] = {'U', 'A', 'V', 'E', 'V', 'L', 'O', 'G'};
+const uint32_t kEventLogVersion = 1;
+
+// Counters reported at close
+struct EventLogStats
+{
+    unsigned long long written = 0;    // Records written to the file
+    unsigned long long dropped = 0;    // Records lost to full rings
+    unsigned long long sampledOut = 0; // Events skipped by the sampling rates
+};
+
+/*
+Open the log file and start the writer thread
+Input: path - Output file (truncated)
+Output: false if the file cannot be created
+*/
+bool openEventLog(const std::string& path);
+
+/*
+Drain every ring, stop the writer thread and close the file.
+Call only after the physics threads have stopped logging.
+*/
+void closeEventLog();
+
+bool isEventLogOpen();
+
+/*
+Keep one in everyN events of a category per logging thread (1 keeps all,
+0 disables the category). Defaults: state 1, collision 1, diagnostic 100.
+*/
+void setEventSampling(EventCategory category, uint32_t everyN);
+
+// Category of an event kind
+EventCategory getEventCategory(EventKind kind);
+
+// Lower-case name of an event kind for the decoder
+const char* getEventKindName(EventKind kind);
+
+// Record an event from any thread; a no-op when the log is closed
+void logEvent(EventKind kind, uint64_t tick, uint32_t uav, uint32_t aux,
+              float value0 = 0.0f, float value1 = 0.0f, float value2 = 0.0f);
+
+// Counters since the log was last opened
+EventLogStats getEventLogStats();
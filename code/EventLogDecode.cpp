@@ -0,0 +1,146 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Text decoder for the binary event log (uav_log_decode). Records are merged
+across the logging threads by tick and printed one per line, optionally
+filtered by event kind, followed by a count per kind.
+
+Usage:
+    uav_log_decode FILE [--kind state|collision|ascent|orbit]
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "EventLog.h"
+
+namespace
+{
+    // Same order as the FlightState enum in FlightController.h
+    const char* const kFlightStateNames[] = {"IDLE", "ASCENT", "ORBIT", "RETURN", "FINISHED"};
+    const uint32_t kFlightStateCount = 5;
+
+    const EventKind kEventKinds[] = {EventKind::STATE_TRANSITION, EventKind::COLLISION,
+                                     EventKind::ASCENT_DIAGNOSTIC, EventKind::ORBIT_DIAGNOSTIC};
+    const size_t kEventKindCount = sizeof(kEventKinds) / sizeof(kEventKinds[0]);
+
+    const char* flightStateName(uint32_t state)
+    {
+        return state < kFlightStateCount ? kFlightStateNames[state] : "UNKNOWN";
+    }
+
+    void printRecord(const EventRecord& record)
+    {
+        printf("tick %llu uav %u %s ", static_cast<unsigned long long>(record.tick), record.uav,
+               getEventKindName(static_cast<EventKind>(record.kind)));
+
+        switch (static_cast<EventKind>(record.kind))
+        {
+            case EventKind::STATE_TRANSITION:
+                printf("%s -> %s at (%.3f, %.3f, %.3f)\n",
+                       flightStateName(record.aux >> 8), flightStateName(record.aux & 0xff),
+                       record.values[0], record.values[1], record.values[2]);
+                break;
+            case EventKind::COLLISION:
+                printf("with uav %u at (%.3f, %.3f, %.3f)\n", record.aux,
+                       record.values[0], record.values[1], record.values[2]);
+                break;
+            case EventKind::ASCENT_DIAGNOSTIC:
+                printf("dist to center %.3f m, from surface %.3f m, speed %.3f m/s\n",
+                       record.values[0], record.values[1], record.values[2]);
+                break;
+            case EventKind::ORBIT_DIAGNOSTIC:
+                printf("tangential speed %.3f m/s, radial error %.3f m, radius %.3f m\n",
+                       record.values[0], record.values[1], record.values[2]);
+                break;
+            default:
+                printf("aux %u values %g %g %g\n", record.aux,
+                       record.values[0], record.values[1], record.values[2]);
+                break;
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2 && !(argc == 4 && std::string(argv[2]) == "--kind"))
+    {
+        fprintf(stderr, "Usage: %s FILE [--kind state|collision|ascent|orbit]\n", argv[0]);
+        return 1;
+    }
+
+    // Optional kind filter
+    int kindFilter = -1;
+    if (argc == 4)
+    {
+        for (size_t k = 0; k < kEventKindCount; ++k)
+        {
+            if (std::string(argv[3]) == getEventKindName(kEventKinds[k]))
+            {
+                kindFilter = static_cast<int>(kEventKinds[k]);
+            }
+        }
+        if (kindFilter < 0)
+        {
+            fprintf(stderr, "Unknown event kind %s\n", argv[3]);
+            return 1;
+        }
+    }
+
+    FILE* file = fopen(argv[1], "rb");
+    if (file == nullptr)
+    {
+        fprintf(stderr, "Cannot open %s\n", argv[1]);
+        return 1;
+    }
+
+    EventLogHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 ||
+        std::memcmp(header.magic, kEventLogMagic, sizeof(header.magic)) != 0 ||
+        header.version != kEventLogVersion || header.recordSize != sizeof(EventRecord))
+    {
+        fprintf(stderr, "%s is not a version %u UAV event log\n", argv[1], kEventLogVersion);
+        fclose(file);
+        return 1;
+    }
+
+    std::vector<EventRecord> records;
+    EventRecord record;
+    while (fread(&record, sizeof(record), 1, file) == 1)
+    {
+        if (kindFilter < 0 || record.kind == kindFilter)
+        {
+            records.push_back(record);
+        }
+    }
+    fclose(file);
+
+    // Each thread's records are already in order; merge the threads by tick
+    std::stable_sort(records.begin(), records.end(), [](const EventRecord& lhs, const EventRecord& rhs)
+    {
+        return lhs.tick < rhs.tick;
+    });
+
+    unsigned long long counts[kEventKindCount] = {};
+    for (const EventRecord& event : records)
+    {
+        printRecord(event);
+        if (event.kind < kEventKindCount)
+        {
+            counts[event.kind]++;
+        }
+    }
+
+    fprintf(stderr, "%zu records:", records.size());
+    for (size_t k = 0; k < kEventKindCount; ++k)
+    {
+        fprintf(stderr, " %s %llu", getEventKindName(kEventKinds[k]), counts[k]);
+    }
+    fprintf(stderr, "\n");
+    return 0;
+}
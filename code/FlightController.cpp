@@ -0,0 +1,742 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Implementation of the state-bucketed flight control stage. The kernels carry
+the control laws of the former ECE_UAV::calculateStateBasedForce, one state
+each.
+*/
+
+#define _USE_MATH_DEFINES
+
+#include "FlightController.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include "CounterRng.h"
+#include "EventLog.h"
+#include "PhysicsGlobals.h"
+
+namespace
+{
+    // Mission geometry shared by the fleet; kernels convert it to their scalar type
+    const Vec3 kSphereCenter(0, 0, 50);
+    const double kSphereRadius = 10.0;
+    const double kMaxForce = 20.0; // Newtons
+
+    const double kIdleSeconds = 5.0;
+    const double kOrbitSeconds = 60.0;
+
+    // Simulated seconds between random orbit direction draws
+    const double kDirectionInterval = 1.0;
+
+    // Helper to replace std::clamp in C++14
+    template <typename T>
+    const T& my_clamp(const T& v, const T& lo, const T& hi)
+    {
+        return (v < lo) ? lo : (hi < v ? hi : v);
+    }
+
+    double millisecondsSince(std::chrono::steady_clock::time_point start)
+    {
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+}
+
+const char* getFlightStateName(FlightState flightState)
+{
+    switch (flightState)
+    {
+        case FlightState::IDLE:     return "IDLE";
+        case FlightState::ASCENT:   return "ASCENT";
+        case FlightState::ORBIT:    return "ORBIT";
+        case FlightState::RETURN:   return "RETURN";
+        case FlightState::FINISHED: return "FINISHED";
+    }
+    return "UNKNOWN";
+}
+
+template <typename T>
+BasicFlightController<T>::BasicFlightController(State& state, const SimClock& clock)
+    : state(state), clock(clock), awakeIdsDirty(true), sleepingEnabled(true), pendingWakeups(0),
+      ticks(0), sharedTotalMs(0.0), transitions(0), sleepingTotal(0.0), wakeups(0)
+{
+    std::fill(std::begin(stateTotalMs), std::end(stateTotalMs), 0.0);
+    std::fill(std::begin(stateTotalUavs), std::end(stateTotalUavs), 0.0);
+    rebuildBuckets();
+}
+
+template <typename T>
+void BasicFlightController<T>::rebuildBuckets()
+{
+    for (std::vector<uint32_t>& bucket : buckets)
+    {
+        bucket.clear();
+    }
+    for (size_t id = 0; id < state.size(); ++id)
+    {
+        if (!state.asleep[id])
+        {
+            buckets[state.flightState[id]].push_back(static_cast<uint32_t>(id));
+        }
+    }
+    // New UAVs have not been through a collision pass yet; treat them as in contact
+    for (size_t id = inContact.size(); id < state.size(); ++id)
+    {
+        contactIds.push_back(static_cast<uint32_t>(id));
+    }
+    inContact.resize(state.size(), 1);
+    awakeIdsDirty = true;
+}
+
+template <typename T>
+size_t BasicFlightController<T>::getBucketSize(FlightState flightState) const
+{
+    return buckets[static_cast<size_t>(flightState)].size();
+}
+
+/*
+Timed wakes, shared pass, kernels in state order, then bucket maintenance;
+each pass a barrier
+*/
+template <typename T>
+void BasicFlightController<T>::run(WorkerPool& pool, size_t batchSize, double deltaTime)
+{
+    size_t bucketed = 0;
+    for (const std::vector<uint32_t>& bucket : buckets)
+    {
+        bucketed += bucket.size();
+    }
+    if (bucketed + state.sleepingCount != state.size() || inContact.size() != state.size())
+    {
+        rebuildBuckets();
+    }
+    wakeDue(clock.now(), deltaTime);
+
+    auto passStart = std::chrono::steady_clock::now();
+    pool.parallelFor(state.size(), batchSize, [&](size_t begin, size_t end)
+    {
+        runShared(begin, end, deltaTime);
+    });
+    double sharedMs = millisecondsSince(passStart);
+
+    // Diagnostics read the same pre-kernel state in a pass of their own, skipped while no log is open
+    if (isEventLogOpen())
+    {
+        for (FlightState logged : {FlightState::ASCENT, FlightState::ORBIT})
+        {
+            const std::vector<uint32_t>& bucket = buckets[static_cast<size_t>(logged)];
+            pool.parallelFor(bucket.size(), batchSize, [&](size_t begin, size_t end)
+            {
+                logDiagnostics(bucket.data() + begin, end - begin);
+            });
+        }
+    }
+
+    typedef void (BasicFlightController::*Kernel)(const uint32_t*, size_t);
+    const Kernel kernels[kFlightStateCount] = {
+        &BasicFlightController::runIdle, &BasicFlightController::runAscent, &BasicFlightController::runOrbit,
+        &BasicFlightController::runReturn, &BasicFlightController::runFinished};
+
+    double kernelMs[kFlightStateCount];
+    size_t bucketSizes[kFlightStateCount];
+    for (size_t s = 0; s < kFlightStateCount; ++s)
+    {
+        const std::vector<uint32_t>& bucket = buckets[s];
+        const Kernel kernel = kernels[s];
+        bucketSizes[s] = bucket.size();
+        passStart = std::chrono::steady_clock::now();
+        pool.parallelFor(bucket.size(), batchSize, [&](size_t begin, size_t end)
+        {
+            (this->*kernel)(bucket.data() + begin, end - begin);
+        });
+        kernelMs[s] = millisecondsSince(passStart);
+    }
+
+    size_t changed = updateBuckets();
+
+    // Ascending awake ids for the integration pass, rebuilt only when some UAV slept or woke
+    if (awakeIdsDirty)
+    {
+        awakeIds.clear();
+        for (size_t id = 0; id < state.size(); ++id)
+        {
+            if (!state.asleep[id])
+            {
+                awakeIds.push_back(static_cast<uint32_t>(id));
+            }
+        }
+        awakeIdsDirty = false;
+    }
+
+    std::lock_guard<std::mutex> lock(statsMutex);
+    ticks++;
+    sharedTotalMs += sharedMs;
+    for (size_t s = 0; s < kFlightStateCount; ++s)
+    {
+        stateTotalMs[s] += kernelMs[s];
+        stateTotalUavs[s] += static_cast<double>(bucketSizes[s]);
+    }
+    transitions += changed;
+    sleepingTotal += static_cast<double>(state.sleepingCount - state.retiredCount);
+    wakeups += pendingWakeups;
+    pendingWakeups = 0;
+}
+
+/*
+Keep the ids that stayed in order, append the movers to their new buckets and
+put the UAVs left at rest to sleep
+*/
+template <typename T>
+size_t BasicFlightController<T>::updateBuckets()
+{
+    const double now = clock.now();
+    size_t changed = 0;
+    for (size_t s = 0; s < kFlightStateCount; ++s)
+    {
+        std::vector<uint32_t>& bucket = buckets[s];
+        size_t kept = 0;
+        for (uint32_t id : bucket)
+        {
+            const uint8_t current = state.flightState[id];
+            if (sleepingEnabled && isAtRest(id, now))
+            {
+                sleep(id);
+                changed += (current != s) ? 1 : 0;
+            }
+            else if (current == s)
+            {
+                bucket[kept++] = id;
+            }
+            else
+            {
+                moved[current].push_back(id);
+                changed++;
+            }
+        }
+        bucket.resize(kept);
+    }
+
+    for (size_t s = 0; s < kFlightStateCount; ++s)
+    {
+        buckets[s].insert(buckets[s].end(), moved[s].begin(), moved[s].end());
+        moved[s].clear();
+    }
+    return changed;
+}
+
+/*
+Work common to every state, over the contiguous id range [begin, end)
+*/
+template <typename T>
+void BasicFlightController<T>::runShared(size_t begin, size_t end, double deltaTime)
+{
+    const T dt = static_cast<T>(deltaTime);
+    const T twoPi = static_cast<T>(2.0 * M_PI);
+    const T minRadius = static_cast<T>(1e-6);
+    const Vector sphereCenter(kSphereCenter);
+    const T sphereRadius = static_cast<T>(kSphereRadius);
+
+    for (size_t id = begin; id < end; ++id)
+    {
+        // Update color phase for ECE6122 requirement and keep it bounded
+        T phase = state.colorPhase[id] + twoPi * T(0.5) * dt; // 0.5 Hz oscillation
+        if (phase > twoPi)
+        {
+            phase = std::fmod(phase, twoPi);
+        }
+        state.colorPhase[id] = phase;
+
+        // Orbit radial error for every lane; only ORBIT lanes are active in the bank
+        T currentRadius = (state.getPosition(id) - sphereCenter).magnitude();
+        if (currentRadius < minRadius)
+        {
+            currentRadius = minRadius;
+        }
+        state.radialControl.setInput(id, 0, currentRadius - sphereRadius);
+    }
+    state.radialControl.calculate(begin, end, deltaTime);
+}
+
+/*
+Distance and speed diagnostics of ASCENT and ORBIT UAVs, sampled by the event
+log's diagnostic rate; the kernels themselves never log diagnostics
+*/
+template <typename T>
+void BasicFlightController<T>::logDiagnostics(const uint32_t* ids, size_t count)
+{
+    const uint64_t tick = clock.getTick();
+    const T minRadius = static_cast<T>(1e-6);
+    const Vector sphereCenter(kSphereCenter);
+    const T sphereRadius = static_cast<T>(kSphereRadius);
+
+    for (size_t k = 0; k < count; ++k)
+    {
+        const size_t id = ids[k];
+        const Vector position = state.getPosition(id);
+        const Vector velocity = state.getVelocity(id);
+        if (state.flightState[id] == static_cast<uint8_t>(FlightState::ASCENT))
+        {
+            T distanceToCenter = (sphereCenter - position).magnitude();
+            logEvent(EventKind::ASCENT_DIAGNOSTIC, tick, static_cast<uint32_t>(id), 0,
+                     static_cast<float>(distanceToCenter), static_cast<float>(distanceToCenter - sphereRadius),
+                     static_cast<float>(velocity.magnitude()));
+        }
+        else
+        {
+            Vector vectorFromCenter = position - sphereCenter;
+            T currentRadius = vectorFromCenter.magnitude();
+            vectorFromCenter = (currentRadius < minRadius) ? Vector(0, 0, minRadius) : vectorFromCenter;
+            currentRadius = std::max(currentRadius, minRadius);
+            Vector radialDirection = vectorFromCenter.normalized();
+            Vector tangentialVelocity = velocity - radialDirection * velocity.dot(radialDirection);
+            logEvent(EventKind::ORBIT_DIAGNOSTIC, tick, static_cast<uint32_t>(id), 0,
+                     static_cast<float>(tangentialVelocity.magnitude()),
+                     static_cast<float>(currentRadius - sphereRadius), static_cast<float>(currentRadius));
+        }
+    }
+}
+
+/*
+IDLE: hold on the ground for the first 5 seconds
+Every field is written through a select; only the launch itself, once per
+UAV, takes the logged transition.
+*/
+template <typename T>
+void BasicFlightController<T>::runIdle(const uint32_t* ids, size_t count)
+{
+    const double now = clock.now();
+    for (size_t k = 0; k < count; ++k)
+    {
+        const size_t id = ids[k];
+        const bool launched = now - state.startTime[id] >= kIdleSeconds;
+
+        // Counter gravity and stay at rest until the launch; no thrust on the transition tick
+        state.fx[id] = 0;
+        state.fy[id] = 0;
+        state.fz[id] = launched ? T(0) : state.gravityCompensation[id];
+        state.vx[id] = launched ? state.vx[id] : T(0);
+        state.vy[id] = launched ? state.vy[id] : T(0);
+        state.vz[id] = launched ? state.vz[id] : T(0);
+        state.wakeTime[id] = launched ? 0.0 : state.startTime[id] + kIdleSeconds;
+
+        if (launched)
+        {
+            transition(id, FlightState::ASCENT);
+        }
+    }
+}
+
+/*
+ASCENT: fly toward the sphere centre at up to 2 m/s until 0.5 m from its surface
+Only arrival branches, as it starts the orbit; the lateral damping and the
+thrust cap are written in select and min forms like ORBIT.
+*/
+template <typename T>
+void BasicFlightController<T>::runAscent(const uint32_t* ids, size_t count)
+{
+    const double now = clock.now();
+    const T maxAscentSpeed = 2;
+    const T minRadius = static_cast<T>(1e-6);
+    const Vector sphereCenter(kSphereCenter);
+    const T sphereRadius = static_cast<T>(kSphereRadius);
+    const T maxForce = static_cast<T>(kMaxForce);
+
+    for (size_t k = 0; k < count; ++k)
+    {
+        const size_t id = ids[k];
+        const Vector position = state.getPosition(id);
+        const Vector velocity = state.getVelocity(id);
+        const T gravityCompensation = state.gravityCompensation[id];
+
+        // Distance to the sphere centre and to its surface
+        Vector directionToCenter = sphereCenter - position;
+        T distanceToCenter = directionToCenter.magnitude();
+        T distanceFromSurface = distanceToCenter - sphereRadius;
+        Vector desiredDirection = directionToCenter.normalized();
+
+        if (distanceFromSurface <= 0.5)
+        {
+            // Reached the sphere: start the orbit, no thrust on the transition tick
+            state.orbitStartTime[id] = now;
+            drawOrbitDirection(id);
+            state.nextDirectionTime[id] = now + kDirectionInterval;
+            state.radialControl.reset(id);
+            state.radialControl.setActive(id, true);
+            transition(id, FlightState::ORBIT);
+            state.setControlForce(id, Vector(0, 0, 0));
+            continue;
+        }
+
+        // Speed component toward the target (positive when moving inward)
+        T speedTowardTarget = velocity.dot(desiredDirection);
+
+        // Base thrust to hover plus directional control budget
+        Vector thrust(0, 0, gravityCompensation);
+        T availableForce = std::max(T(0), maxForce - gravityCompensation);
+
+        // Taper the target speed as we approach the sphere to avoid overshoot
+        T normalizedDistance = my_clamp(distanceFromSurface / sphereRadius, T(0), T(1));
+        T targetSpeed = normalizedDistance * maxAscentSpeed;
+
+        // Directional control: accelerate or brake along desiredDirection
+        T speedError = targetSpeed - speedTowardTarget;
+        T controlRatio = my_clamp(speedError / maxAscentSpeed, T(-1), T(1));
+        thrust += desiredDirection * (availableForce * controlRatio);
+
+        // Lateral damping to keep approach aligned with the target direction; below
+        // 0.05 m/s the ratio is 0 and the guarded direction adds nothing
+        Vector lateralVelocity = velocity - desiredDirection * speedTowardTarget;
+        T lateralSpeed = lateralVelocity.magnitude();
+        bool damping = lateralSpeed > T(0.05) && availableForce > 0;
+        Vector lateralDir = lateralVelocity / std::max(lateralSpeed, minRadius);
+        T lateralRatio = damping ? my_clamp(lateralSpeed / maxAscentSpeed, T(0), T(1)) : T(0);
+        thrust += lateralDir * (-availableForce * T(0.6) * lateralRatio);
+
+        // Cap at the vehicle's capability; a scale of exactly 1 leaves the thrust untouched
+        T thrustMagnitude = thrust.magnitude();
+        thrust = thrust * std::min(T(1), maxForce / thrustMagnitude);
+
+        state.setControlForce(id, thrust);
+    }
+}
+
+/*
+ORBIT: hold the 10 m sphere with the radial PID (evaluated in the shared pass)
+and wander along its surface at 2-10 m/s
+The due direction redraws run in a loop of their own, as each advances the
+UAV's random stream; the force loop after it is written in select and min/max
+forms.
+*/
+template <typename T>
+void BasicFlightController<T>::runOrbit(const uint32_t* ids, size_t count)
+{
+    const double now = clock.now();
+    const T minOrbitSpeed = 2;
+    const T maxOrbitSpeed = 10;
+    const T targetOrbitSpeed = 6;
+    const T minRadius = static_cast<T>(1e-6);
+    const Vector sphereCenter(kSphereCenter);
+    const T maxForce = static_cast<T>(kMaxForce);
+
+    // Periodically refresh the random direction to keep paths varied
+    for (size_t k = 0; k < count; ++k)
+    {
+        const size_t id = ids[k];
+        if (now >= state.nextDirectionTime[id])
+        {
+            drawOrbitDirection(id);
+            state.nextDirectionTime[id] = now + kDirectionInterval;
+        }
+    }
+
+    for (size_t k = 0; k < count; ++k)
+    {
+        const size_t id = ids[k];
+        const Vector position = state.getPosition(id);
+        const Vector velocity = state.getVelocity(id);
+        const T gravityCompensation = state.gravityCompensation[id];
+
+        // The UAV keeps orbiting after the 60 s requirement is met
+        state.orbitCompleted[id] |= static_cast<uint8_t>(now - state.orbitStartTime[id] >= kOrbitSeconds);
+
+        Vector vectorFromCenter = position - sphereCenter;
+        T currentRadius = vectorFromCenter.magnitude();
+        vectorFromCenter = (currentRadius < minRadius) ? Vector(0, 0, minRadius) : vectorFromCenter;
+        currentRadius = std::max(currentRadius, minRadius);
+
+        Vector radialDirection = vectorFromCenter.normalized();
+        T radialSpeed = velocity.dot(radialDirection);
+
+        T availableForce = std::max(T(0), maxForce - gravityCompensation);
+
+        // Radial PID output with additional damping on radial velocity
+        T radialControl = state.radialControl.getOutput(id) - T(2) * radialSpeed;
+        radialControl = my_clamp(radialControl, -availableForce, availableForce);
+        Vector radialCorrectionForce = radialDirection * radialControl;
+
+        // Tangential direction (project random vector onto tangent plane); a direction
+        // along the radius falls back to a tangent perpendicular to the x or y axis
+        Vector randomDirection(state.directionX[id], state.directionY[id], state.directionZ[id]);
+        Vector tangentSeed = randomDirection - radialDirection * randomDirection.dot(radialDirection);
+        Vector fallbackSeed = (std::abs(radialDirection.x) < T(0.5))
+            ? Vector(0, -radialDirection.z, radialDirection.y)
+            : Vector(radialDirection.z, 0, -radialDirection.x);
+        tangentSeed = (tangentSeed.magnitude() < minRadius) ? fallbackSeed : tangentSeed;
+        Vector tangentDirection = tangentSeed.normalized();
+
+        Vector tangentialVelocity = velocity - radialDirection * radialSpeed;
+        T tangentialSpeed = tangentialVelocity.magnitude();
+
+        // Push up below the band, brake above it, steer toward 6 m/s inside it
+        T belowBandRatio = my_clamp((minOrbitSpeed - tangentialSpeed) / minOrbitSpeed, T(0), T(1));
+        T aboveBandRatio = -my_clamp((tangentialSpeed - maxOrbitSpeed) / maxOrbitSpeed, T(0), T(1));
+        T midBandRatio = my_clamp((targetOrbitSpeed - tangentialSpeed) / targetOrbitSpeed, T(-0.5), T(0.5));
+        T tangentialRatio = (tangentialSpeed < minOrbitSpeed) ? belowBandRatio
+            : ((tangentialSpeed > maxOrbitSpeed) ? aboveBandRatio : midBandRatio);
+
+        // Brake against the actual motion rather than the wander direction
+        bool braking = tangentialRatio < 0 && tangentialSpeed > T(0.05);
+        Vector tangentControlDirection = braking ? tangentialVelocity.normalized() : tangentDirection;
+
+        Vector tangentialForce = tangentControlDirection * (availableForce * tangentialRatio);
+
+        Vector totalForce = radialCorrectionForce + tangentialForce;
+        totalForce.z += gravityCompensation;
+
+        // Cap at the vehicle's capability; a scale of exactly 1 leaves the force untouched
+        T totalMagnitude = totalForce.magnitude();
+        totalForce = totalForce * std::min(T(1), maxForce / totalMagnitude);
+
+        state.setControlForce(id, totalForce);
+    }
+}
+
+/*
+RETURN: not flown yet, no thrust (as before the stage existed)
+*/
+template <typename T>
+void BasicFlightController<T>::runReturn(const uint32_t* ids, size_t count)
+{
+    for (size_t k = 0; k < count; ++k)
+    {
+        state.setControlForce(ids[k], Vector(0, 0, 0));
+    }
+}
+
+/*
+FINISHED: hover in place; a UAV hovering at rest may sleep for good
+*/
+template <typename T>
+void BasicFlightController<T>::runFinished(const uint32_t* ids, size_t count)
+{
+    for (size_t k = 0; k < count; ++k)
+    {
+        const size_t id = ids[k];
+        state.setControlForce(id, Vector(0, 0, state.gravityCompensation[id]));
+        state.wakeTime[id] = std::numeric_limits<double>::infinity();
+    }
+}
+
+/*
+Uniform components in [-1, 1) from (seed, id, tick, draw); no shared generator
+*/
+template <typename T>
+void BasicFlightController<T>::drawOrbitDirection(size_t id)
+{
+    const PhiloxBlock bits = counterRandom(getRandomSeed(), static_cast<uint32_t>(id), clock.getTick(),
+                                           state.directionDraws[id]++);
+    Vector direction = Vector(static_cast<T>(toSignedUnit(bits.word[0])), static_cast<T>(toSignedUnit(bits.word[1])),
+                              static_cast<T>(toSignedUnit(bits.word[2]))).normalized();
+    state.directionX[id] = direction.x;
+    state.directionY[id] = direction.y;
+    state.directionZ[id] = direction.z;
+}
+
+template <typename T>
+void BasicFlightController<T>::transition(size_t id, FlightState to)
+{
+    const uint8_t from = state.flightState[id];
+    state.flightState[id] = static_cast<uint8_t>(to);
+
+    uint32_t states = (static_cast<uint32_t>(from) << 8) | static_cast<uint32_t>(to);
+    Vector position = state.getPosition(id);
+    logEvent(EventKind::STATE_TRANSITION, clock.getTick(), static_cast<uint32_t>(id), states,
+             static_cast<float>(position.x), static_cast<float>(position.y), static_cast<float>(position.z));
+}
+
+/*
+At rest: the integrator computes zero acceleration and keeps the position. A
+UAV that was in contact last tick may still be overlapping its neighbour, so
+it stays awake until a tick passes without contact.
+*/
+template <typename T>
+bool BasicFlightController<T>::isAtRest(size_t id, double now) const
+{
+    return state.wakeTime[id] > now && !inContact[id] &&
+           state.vx[id] == 0 && state.vy[id] == 0 && state.vz[id] == 0 &&
+           state.fx[id] == 0 && state.fy[id] == 0 && state.fz[id] == state.gravityCompensation[id];
+}
+
+template <typename T>
+void BasicFlightController<T>::sleep(uint32_t id)
+{
+    state.asleep[id] = 1;
+    state.sleepingCount++;
+
+    // What the skipped integrations would have stored
+    state.prevPx[id] = state.px[id];
+    state.prevPy[id] = state.py[id];
+    state.prevPz[id] = state.pz[id];
+    state.ax[id] = 0;
+    state.ay[id] = 0;
+    state.az[id] = 0;
+
+    wakeQueue.push(WakeEntry(state.wakeTime[id], id));
+    awakeIdsDirty = true;
+}
+
+template <typename T>
+void BasicFlightController<T>::wake(uint32_t id)
+{
+    state.asleep[id] = 0;
+    state.sleepingCount--;
+    buckets[state.flightState[id]].push_back(id);
+    awakeIdsDirty = true;
+    pendingWakeups++;
+}
+
+/*
+Waking on the tick nearest the wake time can be up to half a step early; the
+kernel then finds the UAV not yet due and it goes back to sleep
+*/
+template <typename T>
+void BasicFlightController<T>::wakeDue(double now, double deltaTime)
+{
+    while (!wakeQueue.empty() && wakeQueue.top().first <= now + 0.5 * deltaTime)
+    {
+        const uint32_t id = wakeQueue.top().second;
+        wakeQueue.pop();
+        if (state.asleep[id] && !state.retired[id])
+        {
+            wake(id);
+        }
+    }
+}
+
+/*
+Retiring stops the UAV where it is, so the skipped integrations would leave it
+unchanged, like a sleeping one
+*/
+template <typename T>
+void BasicFlightController<T>::retire(uint32_t id)
+{
+    if (state.retired[id])
+    {
+        return;
+    }
+    if (!state.asleep[id])
+    {
+        // Not bucketed yet if it joined since the last run(); rebuildBuckets skips it then
+        std::vector<uint32_t>& bucket = buckets[state.flightState[id]];
+        std::vector<uint32_t>::iterator entry = std::find(bucket.begin(), bucket.end(), id);
+        if (entry != bucket.end())
+        {
+            bucket.erase(entry);
+        }
+        state.asleep[id] = 1;
+        state.sleepingCount++;
+    }
+    state.retired[id] = 1;
+    state.retiredCount++;
+
+    const Vector zero(0, 0, 0);
+    state.setVelocity(id, zero);
+    state.setControlForce(id, zero);
+    state.prevPx[id] = state.px[id];
+    state.prevPy[id] = state.py[id];
+    state.prevPz[id] = state.pz[id];
+    state.ax[id] = 0;
+    state.ay[id] = 0;
+    state.az[id] = 0;
+    state.radialControl.setActive(id, false);
+    awakeIdsDirty = true;
+}
+
+template <typename T>
+void BasicFlightController<T>::launch(uint32_t id)
+{
+    state.retired[id] = 0;
+    state.retiredCount--;
+    state.asleep[id] = 0;
+    state.sleepingCount--;
+    buckets[state.flightState[id]].push_back(id);
+
+    // Like a new UAV, it has not been through a collision pass yet
+    if (!inContact[id])
+    {
+        inContact[id] = 1;
+        contactIds.push_back(id);
+    }
+    awakeIdsDirty = true;
+}
+
+template <typename T>
+void BasicFlightController<T>::recordContacts(const std::vector<CollisionPair>& contacts)
+{
+    for (uint32_t id : contactIds)
+    {
+        inContact[id] = 0;
+    }
+    contactIds.clear();
+    if (!sleepingEnabled)
+    {
+        return;
+    }
+
+    for (const CollisionPair& contact : contacts)
+    {
+        const uint32_t ids[2] = {contact.a, contact.b};
+        for (uint32_t id : ids)
+        {
+            if (!inContact[id])
+            {
+                inContact[id] = 1;
+                contactIds.push_back(id);
+            }
+            if (state.asleep[id])
+            {
+                wake(id);
+            }
+        }
+    }
+}
+
+template <typename T>
+FlightControlStats BasicFlightController<T>::getStats() const
+{
+    std::lock_guard<std::mutex> lock(statsMutex);
+    FlightControlStats result;
+    result.ticks = ticks;
+    result.transitions = transitions;
+    result.wakeups = wakeups;
+    if (ticks > 0)
+    {
+        result.sharedMs = sharedTotalMs / ticks;
+        result.sleepingUavs = sleepingTotal / ticks;
+        for (size_t s = 0; s < kFlightStateCount; ++s)
+        {
+            result.stateMs[s] = stateTotalMs[s] / ticks;
+            result.stateUavs[s] = stateTotalUavs[s] / ticks;
+        }
+    }
+    return result;
+}
+
+template <typename T>
+void BasicFlightController<T>::printReport(FILE* out) const
+{
+    FlightControlStats report = getStats();
+    fprintf(out, "Flight control: %.3f ms/tick shared pass, %llu state transitions\n",
+            report.sharedMs, report.transitions);
+    for (size_t s = 0; s < kFlightStateCount; ++s)
+    {
+        fprintf(out, "  %-9s %.3f ms/tick over %.1f UAVs\n",
+                getFlightStateName(static_cast<FlightState>(s)), report.stateMs[s], report.stateUavs[s]);
+    }
+    if (sleepingEnabled)
+    {
+        fprintf(out, "  sleeping  %.1f UAVs, %llu wakeups\n", report.sleepingUavs, report.wakeups);
+    }
+    else
+    {
+        fprintf(out, "  sleeping  disabled\n");
+    }
+}
+
+template class BasicFlightController<float>;
+template class BasicFlightController<double>;
@@ -0,0 +1,201 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Data-oriented control stage of the swarm tick. UAV ids are kept in one bucket
+per FlightState, and each state has its own kernel that runs over its bucket
+without dispatching on the state per UAV:
+    - shared pass over all ids: colour phase and orbit radial PID inputs,
+      then the PIDBank for the range
+    - IDLE, ASCENT, ORBIT, RETURN, FINISHED kernels over their buckets
+    - bucket maintenance: ids whose state changed move to their new bucket
+The flight state itself lives in the SwarmState control arrays. Wall time and
+UAV count are accumulated per state so the control phase can be broken down.
+
+Sleeping: a UAV whose kernel leaves it at rest (zero velocity, thrust exactly
+cancelling gravity), that had no contact last tick and that has a future wake
+time (the IDLE->ASCENT deadline, never for a FINISHED hover) is taken out of
+its bucket and put to sleep. Integrating it would not move it, so the stepper
+skips it, and the collision broadphase skips pairs of two sleeping UAVs. It
+wakes on the tick nearest its wake time (never after) or when a contact
+involves it, and rejoins its bucket. Sleeping changes no trajectory; it only
+removes work. Retired UAVs reuse the same mechanism: they are asleep with no
+wake time until launched again.
+
+Like the store it drives, the controller is templated on the physics scalar;
+its kernels evaluate the control laws entirely in that type.
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <utility>
+#include <vector>
+#include "Broadphase.h"
+#include "SimClock.h"
+#include "SwarmState.h"
+#include "WorkerPool.h"
+
+// Flight state enumeration for state machine
+enum class FlightState
+{
+    IDLE,       // 0-5 seconds: Remain on ground
+    ASCENT,     // Launch phase: Fly to (0,0,50) with max velocity 2 m/s
+    ORBIT,      // Orbit phase: Fly on sphere surface for 60 seconds
+    RETURN,     // Descend and travel back to launch position
+    FINISHED    // Simulation complete
+};
+
+const size_t kFlightStateCount = 5;
+
+// Name of a flight state for reports
+const char* getFlightStateName(FlightState state);
+
+// Control time per flight state (thread-safe snapshot)
+struct FlightControlStats
+{
+    unsigned long long ticks = 0;                    // Control passes run
+    double sharedMs = 0.0;                           // Mean wall time of the shared pass per tick
+    double stateMs[kFlightStateCount] = {};          // Mean wall time of each state kernel per tick
+    double stateUavs[kFlightStateCount] = {};        // Mean bucket size per tick
+    unsigned long long transitions = 0;              // State changes since start
+    double sleepingUavs = 0.0;                       // Mean sleeping UAVs per tick
+    unsigned long long wakeups = 0;                  // Sleeping UAVs woken since start
+};
+
+template <typename T>
+class BasicFlightController
+{
+    public:
+        typedef BasicSwarmState<T> State;
+        typedef BasicVec3<T> Vector;
+
+        /*
+        Constructor
+        Input:
+            - state: Swarm store holding the flight control arrays (must outlive the controller)
+            - clock: Simulated clock of the fleet
+        */
+        BasicFlightController(State& state, const SimClock& clock);
+
+        BasicFlightController(const BasicFlightController&) = delete;
+        BasicFlightController& operator=(const BasicFlightController&) = delete;
+
+        /*
+        Compute this tick's control force of every UAV
+        Input:
+            - pool: Workers that run each pass
+            - batchSize: Ids per batch
+            - deltaTime: Time step (seconds)
+        Buckets are rebuilt first if UAVs were added since the last call.
+        */
+        void run(WorkerPool& pool, size_t batchSize, double deltaTime);
+
+        // Number of UAVs currently in a state's bucket
+        size_t getBucketSize(FlightState flightState) const;
+
+        // Put UAVs at rest to sleep (default on). Call at startup, before stepping.
+        void setSleepingEnabled(bool enabled) { sleepingEnabled = enabled; }
+        bool isSleepingEnabled() const { return sleepingEnabled; }
+
+        /*
+        Wake the sleeping UAVs of this tick's contacts and keep every UAV in
+        contact awake through the next tick
+        Input: contacts - Contacts resolved this tick
+        Call once per tick after collision response, before the next run().
+        */
+        void recordContacts(const std::vector<CollisionPair>& contacts);
+
+        /*
+        Take a UAV out of service: it stops, sleeps for good and is excluded
+        from contacts (SwarmState::retired). Call between ticks.
+        Input: id - UAV to retire; ignored if already retired
+        */
+        void retire(uint32_t id);
+
+        /*
+        Return a retired UAV to service in the bucket of its stored state, awake
+        Input: id - Retired UAV whose slot was refilled by SwarmState::reset
+        Call between ticks.
+        */
+        void launch(uint32_t id);
+
+        // Awake UAV ids in ascending order, valid from one run() to the next
+        const std::vector<uint32_t>& getAwakeIds() const { return awakeIds; }
+
+        FlightControlStats getStats() const;
+
+        // Print the per-state control breakdown
+        void printReport(FILE* out) const;
+
+    private:
+        // Put every id into the bucket of its stored state
+        void rebuildBuckets();
+
+        // Move ids whose state changed during the kernels (stable, serial)
+        size_t updateBuckets();
+
+        // Colour phase and PID inputs for ids [begin, end), then the PID bank
+        void runShared(size_t begin, size_t end, double deltaTime);
+
+        // Sampled ASCENT/ORBIT diagnostics for bucket entries [ids, ids + count)
+        void logDiagnostics(const uint32_t* ids, size_t count);
+
+        // One kernel per state over bucket entries [ids, ids + count)
+        void runIdle(const uint32_t* ids, size_t count);
+        void runAscent(const uint32_t* ids, size_t count);
+        void runOrbit(const uint32_t* ids, size_t count);
+        void runReturn(const uint32_t* ids, size_t count);
+        void runFinished(const uint32_t* ids, size_t count);
+
+        // Draw a new random orbit direction from the UAV's counter-based stream
+        void drawOrbitDirection(size_t id);
+
+        // Change a UAV's state and record the transition in the event log
+        void transition(size_t id, FlightState to);
+
+        // Whether integrating the UAV would leave it unchanged and it has a future wake time
+        bool isAtRest(size_t id, double now) const;
+
+        // Take a UAV at rest out of the buckets until its wake time
+        void sleep(uint32_t id);
+
+        // Return a sleeping UAV to the bucket of its state
+        void wake(uint32_t id);
+
+        // Wake the UAVs whose wake time falls on or before this tick
+        void wakeDue(double now, double deltaTime);
+
+        State& state;
+        const SimClock& clock;
+        std::vector<uint32_t> buckets[kFlightStateCount];
+        std::vector<uint32_t> moved[kFlightStateCount];
+
+        // Sleeping UAVs ordered by wake time; entries of UAVs woken early are skipped
+        typedef std::pair<double, uint32_t> WakeEntry;
+        std::priority_queue<WakeEntry, std::vector<WakeEntry>, std::greater<WakeEntry>> wakeQueue;
+        std::vector<uint32_t> awakeIds;
+        std::vector<uint8_t> inContact;        // 1 if the UAV had a contact last tick
+        std::vector<uint32_t> contactIds;      // Ids with inContact set
+        bool awakeIdsDirty;
+        bool sleepingEnabled;
+        unsigned long long pendingWakeups;
+
+        // Timing accumulators, guarded by statsMutex
+        mutable std::mutex statsMutex;
+        unsigned long long ticks;
+        double sharedTotalMs;
+        double stateTotalMs[kFlightStateCount];
+        double stateTotalUavs[kFlightStateCount];
+        unsigned long long transitions;
+        double sleepingTotal;
+        unsigned long long wakeups;
+};
+
+typedef BasicFlightController<PhysicsScalar> FlightController;
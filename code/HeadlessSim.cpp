@@ -0,0 +1,535 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Headless swarm simulation (uav_sim_headless). Runs the same physics core as
+FinalProject without GLFW/GLEW/OpenGL so it can benchmark and soak-test on
+render-less machines. Scenarios are driven from the command line and the
+program reports throughput, collision counts and the final swarm state.
+The duration is simulated time; by default ticks run back to back (lockstep)
+so a full mission finishes in a fraction of its simulated length.
+
+Besides the simulation, --mode compare-precision flies the formation in float
+and double side by side. The self-checks and micro-benchmarks are in uav_checks
+(tests/).
+--churn N retires N UAVs in service and launches N new ones from the field
+every simulated second, reusing the retired slots.
+
+Usage:
+    uav_sim_headless [--mode simulate|compare-precision]
+                     [--uavs N] [--duration SECONDS] [--formation grid|line|ring|random]
+                     [--seed N] [--broadphase brute|grid|dbvt|sweep] [--threads N]
+                     [--radius METERS] [--clock lockstep|realtime|warp] [--warp N]
+                     [--overrun catchup|drop] [--max-catch-up N] [--dt SECONDS] [--ccd on|off]
+                     [--sleep on|off] [--integrator taylor|euler|verlet|rk4] [--churn N]
+                     [--event-log FILE] [--log-sampling STATE,COLLISION,DIAGNOSTIC]
+*/
+
+#define _USE_MATH_DEFINES
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include "ECE_UAV.h"
+#include "EventLog.h"
+#include "Integrators.h"
+#include "PhysicsGlobals.h"
+#include "PrecisionComparison.h"
+#include "SimClock.h"
+#include "SwarmMembership.h"
+#include "SwarmState.h"
+#include "SwarmStepper.h"
+#include "UavArena.h"
+
+namespace
+{
+    // Command line scenario
+    struct ScenarioOptions
+    {
+        std::string mode = "simulate";
+        int uavCount = 15;
+        double durationSeconds = 10.0;
+        std::string formation = "grid";
+        unsigned int seed = 1;
+        BroadphaseType broadphase = BroadphaseType::SPATIAL_HASH;
+        size_t threadCount = 0;
+        double boundingRadius = 0.1; // Physical 20 cm cube
+        SimClockMode clockMode = SimClockMode::LOCKSTEP;
+        double warpFactor = 10.0;    // Simulated seconds per wall second for --clock warp
+        OverrunPolicy overrunPolicy = OverrunPolicy::CATCH_UP;
+        unsigned int maxCatchUpTicks = 5; // Most ticks CATCH_UP may fall behind
+        double timeStep = 0.01;      // Fixed physics step (100 Hz by default)
+        bool continuousCollision = true; // Swept-sphere contacts, needed for steps above ~10 ms
+        bool sleeping = true;        // Skip UAVs at rest until their wake time or a contact
+        IntegratorType integrator = IntegratorType::CONSTANT_ACCELERATION; // Kinematics update policy
+        int churn = 0;               // UAVs retired and launched per simulated second
+        std::string eventLogPath;    // Binary event log, none when empty
+        uint32_t logSampling[3] = {1, 1, 100}; // Keep 1 in N state/collision/diagnostic events
+    };
+
+    // Ground spacing between neighbouring UAVs in the generated layouts (meters)
+    const double kFormationSpacing = 3.0;
+
+    // Football field half extents used for the random layout (matches main.cpp)
+    const double kFieldHalfWidth = 256.0;
+    const double kFieldHalfDepth = 128.0;
+
+    void printUsage(const char* program)
+    {
+        fprintf(stderr,
+                "Usage: %s [--mode simulate|compare-precision]\n"
+                "          [--uavs N] [--duration SECONDS] [--formation grid|line|ring|random]\n"
+                "          [--seed N] [--broadphase brute|grid|dbvt|sweep] [--threads N]\n"
+                "          [--radius METERS] [--clock lockstep|realtime|warp] [--warp N]\n"
+                "          [--overrun catchup|drop] [--max-catch-up N] [--dt SECONDS] [--ccd on|off]\n"
+                "          [--sleep on|off] [--integrator taylor|euler|verlet|rk4] [--churn N]\n"
+                "          [--event-log FILE] [--log-sampling STATE,COLLISION,DIAGNOSTIC]\n", program);
+    }
+
+    /*
+    Parse the command line into options
+    Output: false on an unknown option or a malformed value
+    */
+    bool parseOptions(int argc, char* argv[], ScenarioOptions& options)
+    {
+        for (int arg = 1; arg < argc; ++arg)
+        {
+            const std::string option = argv[arg];
+            if (option == "--help" || option == "-h" || arg + 1 >= argc)
+            {
+                return false;
+            }
+            const std::string value = argv[++arg];
+
+            if (option == "--mode")
+            {
+                options.mode = value;
+            }
+            else if (option == "--uavs")
+            {
+                options.uavCount = std::atoi(value.c_str());
+            }
+            else if (option == "--duration")
+            {
+                options.durationSeconds = std::atof(value.c_str());
+            }
+            else if (option == "--formation")
+            {
+                options.formation = value;
+            }
+            else if (option == "--seed")
+            {
+                options.seed = static_cast<unsigned int>(std::strtoul(value.c_str(), nullptr, 10));
+            }
+            else if (option == "--broadphase")
+            {
+                if (!parseBroadphaseType(value, options.broadphase))
+                {
+                    return false;
+                }
+            }
+            else if (option == "--threads")
+            {
+                options.threadCount = static_cast<size_t>(std::atoi(value.c_str()));
+            }
+            else if (option == "--radius")
+            {
+                options.boundingRadius = std::atof(value.c_str());
+            }
+            else if (option == "--clock")
+            {
+                if (!parseSimClockMode(value, options.clockMode))
+                {
+                    return false;
+                }
+            }
+            else if (option == "--warp")
+            {
+                options.warpFactor = std::atof(value.c_str());
+            }
+            else if (option == "--overrun")
+            {
+                if (!parseOverrunPolicy(value, options.overrunPolicy))
+                {
+                    return false;
+                }
+            }
+            else if (option == "--max-catch-up")
+            {
+                options.maxCatchUpTicks = static_cast<unsigned int>(std::strtoul(value.c_str(), nullptr, 10));
+            }
+            else if (option == "--dt")
+            {
+                options.timeStep = std::atof(value.c_str());
+            }
+            else if (option == "--ccd")
+            {
+                if (value != "on" && value != "off")
+                {
+                    return false;
+                }
+                options.continuousCollision = value == "on";
+            }
+            else if (option == "--sleep")
+            {
+                if (value != "on" && value != "off")
+                {
+                    return false;
+                }
+                options.sleeping = value == "on";
+            }
+            else if (option == "--integrator")
+            {
+                if (!parseIntegratorType(value, options.integrator))
+                {
+                    return false;
+                }
+            }
+            else if (option == "--churn")
+            {
+                options.churn = std::atoi(value.c_str());
+            }
+            else if (option == "--event-log")
+            {
+                options.eventLogPath = value;
+            }
+            else if (option == "--log-sampling")
+            {
+                unsigned int state, collision, diagnostic;
+                if (sscanf(value.c_str(), "%u,%u,%u", &state, &collision, &diagnostic) != 3)
+                {
+                    return false;
+                }
+                options.logSampling[0] = state;
+                options.logSampling[1] = collision;
+                options.logSampling[2] = diagnostic;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        const std::string modes[] = {"simulate", "compare-precision"};
+        bool knownMode = std::find(std::begin(modes), std::end(modes), options.mode) != std::end(modes);
+        const std::string formations[] = {"grid", "line", "ring", "random"};
+        bool knownFormation = std::find(std::begin(formations), std::end(formations), options.formation) != std::end(formations);
+        return knownMode && knownFormation && options.uavCount > 0 && options.durationSeconds > 0.0 &&
+               options.warpFactor > 0.0 && options.timeStep > 0.0 && options.churn >= 0;
+    }
+
+    /*
+    Generate ground positions for the requested layout
+    Input: options - scenario (count, formation, seed)
+    Output: One position per UAV at z = 0
+    */
+    std::vector<Vec3> buildFormation(const ScenarioOptions& options)
+    {
+        std::vector<Vec3> positions;
+        positions.reserve(options.uavCount);
+        const int count = options.uavCount;
+
+        if (options.formation == "line")
+        {
+            // Single row along x centred on the origin
+            for (int i = 0; i < count; ++i)
+            {
+                positions.emplace_back((i - 0.5 * (count - 1)) * kFormationSpacing, 0.0, 0.0);
+            }
+        }
+        else if (options.formation == "ring")
+        {
+            // Evenly spaced circle, large enough to keep the ground spacing
+            double radius = std::max(20.0, count * kFormationSpacing / (2.0 * M_PI));
+            for (int i = 0; i < count; ++i)
+            {
+                double angle = 2.0 * M_PI * i / count;
+                positions.emplace_back(radius * std::cos(angle), radius * std::sin(angle), 0.0);
+            }
+        }
+        else if (options.formation == "random")
+        {
+            // Uniform over the football field
+            std::mt19937 generator(options.seed);
+            std::uniform_real_distribution<double> xDistribution(-kFieldHalfWidth, kFieldHalfWidth);
+            std::uniform_real_distribution<double> yDistribution(-kFieldHalfDepth, kFieldHalfDepth);
+            for (int i = 0; i < count; ++i)
+            {
+                double x = xDistribution(generator);
+                double y = yDistribution(generator);
+                positions.emplace_back(x, y, 0.0);
+            }
+        }
+        else
+        {
+            // Square grid centred on the origin
+            int columns = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(count))));
+            int rows = (count + columns - 1) / columns;
+            for (int i = 0; i < count; ++i)
+            {
+                int row = i / columns;
+                int column = i % columns;
+                positions.emplace_back((column - 0.5 * (columns - 1)) * kFormationSpacing,
+                                       (row - 0.5 * (rows - 1)) * kFormationSpacing, 0.0);
+            }
+        }
+        return positions;
+    }
+
+    /*
+    FNV-1a hash over the bits of every position and velocity
+    Output: Equal for runs that produced identical trajectories
+    */
+    uint64_t stateChecksum(const SwarmState& state)
+    {
+        uint64_t hash = 14695981039346656037ull;
+        const SwarmState::Array* arrays[] = {&state.px, &state.py, &state.pz, &state.vx, &state.vy, &state.vz};
+        for (const SwarmState::Array* array : arrays)
+        {
+            for (double value : *array)
+            {
+                uint64_t bits;
+                std::memcpy(&bits, &value, sizeof(bits));
+                for (int byte = 0; byte < 8; ++byte)
+                {
+                    hash = (hash ^ ((bits >> (8 * byte)) & 0xff)) * 1099511628211ull;
+                }
+            }
+        }
+        return hash;
+    }
+
+    /*
+    Step the fleet with the given integrator policy and print the stepper reports
+    Input:
+        - options: Scenario (threads, overrun policy, sleeping, churn)
+        - swarmState, simClock, uavs, uavArena: Fleet built for the scenario
+        - tickCount: Ticks to run
+    */
+    template <typename Integrator>
+    void stepScenario(const ScenarioOptions& options, SwarmState& swarmState, SimClock& simClock,
+                      std::vector<ECE_UAV*>& uavs, UavArena& uavArena, unsigned long long tickCount)
+    {
+        BasicSwarmStepper<Integrator> stepper(swarmState, simClock, uavs, options.threadCount);
+        stepper.getTickScheduler().setOverrunPolicy(options.overrunPolicy, options.maxCatchUpTicks);
+        stepper.getFlightController().setSleepingEnabled(options.sleeping);
+        stepper.setUavArena(&uavArena);
+        auto wallStart = std::chrono::steady_clock::now();
+        if (options.churn == 0)
+        {
+            stepper.run(tickCount);
+        }
+        else
+        {
+            // Queue each second's churn from the published membership, applied on
+            // the next tick; the formation drew from seed, churn from seed + 1
+            std::mt19937 generator(options.seed + 1);
+            std::uniform_real_distribution<double> xDistribution(-kFieldHalfWidth, kFieldHalfWidth);
+            std::uniform_real_distribution<double> yDistribution(-kFieldHalfDepth, kFieldHalfDepth);
+            const unsigned long long ticksPerSecond =
+                std::max(1ull, static_cast<unsigned long long>(std::llround(1.0 / options.timeStep)));
+            SwarmMembership& membership = stepper.getMembership();
+            const size_t reader = membership.registerReader();
+            for (unsigned long long done = 0; done < tickCount; )
+            {
+                if (done > 0)
+                {
+                    SwarmMembership::ReadGuard guard(membership, reader);
+                    std::vector<uint32_t> candidates = guard.ids();
+                    for (int k = 0; k < options.churn && !candidates.empty(); ++k)
+                    {
+                        size_t pick = std::uniform_int_distribution<size_t>(0, candidates.size() - 1)(generator);
+                        stepper.requestRetire(candidates[pick]);
+                        candidates[pick] = candidates.back();
+                        candidates.pop_back();
+                    }
+                    for (int k = 0; k < options.churn; ++k)
+                    {
+                        double x = xDistribution(generator);
+                        double y = yDistribution(generator);
+                        stepper.requestLaunch(Vec3(x, y, 0.0));
+                    }
+                }
+                const unsigned long long chunk = std::min(ticksPerSecond, tickCount - done);
+                stepper.run(chunk);
+                done += chunk;
+            }
+            membership.unregisterReader(reader);
+        }
+        std::chrono::duration<double> wallElapsed = std::chrono::steady_clock::now() - wallStart;
+
+        SwarmStepperStats stats = stepper.getStats();
+        double uavTicksPerSecond = stats.ticks * static_cast<double>(uavs.size()) / wallElapsed.count();
+
+        printf("Throughput: %llu ticks (%.2f s simulated) in %.2f s wall, %.1fx real time, on %zu threads (batch %zu)\n",
+               stats.ticks, simClock.now(), wallElapsed.count(), simClock.now() / wallElapsed.count(),
+               stepper.getThreadCount(), stepper.getBatchSize());
+        printf("  %.0f UAV-ticks/s, phases (ms/tick) control %.3f, kinematics %.3f, collision %.3f, publish %.3f\n",
+               uavTicksPerSecond, stats.controlPhaseMs, stats.kinematicsPhaseMs,
+               stats.collisionPhaseMs, stats.publishPhaseMs);
+        printf("Collisions: %llu resolved, %.2f contacts/tick in up to %zu colours, %.3f ms/tick colouring and resolving\n",
+               getCollisionCount(), stats.contactsPerTick, stats.maxContactColors, stats.contactResolveMs);
+        printf("  %zu candidate pairs and %zu contacts in the last tick\n",
+               getCollisionPairCount(), getCollisionContactCount());
+        if (options.churn > 0)
+        {
+            MembershipStats membershipStats = stepper.getMembership().getStats();
+            printf("Membership: %llu launched (%llu into retired slots), %llu retired, %llu dropped; %llu versions published, %llu reclaimed\n",
+                   stats.launched, stats.reusedSlots, stats.retired, stats.launchesDropped,
+                   membershipStats.published, membershipStats.reclaimed);
+        }
+        stepper.getFlightController().printReport(stdout);
+        stepper.getTickScheduler().printReport(stdout);
+    }
+
+    // Summarise the swarm at exit
+    void printFinalState(std::vector<ECE_UAV*>& uavs, const SwarmState& swarmState)
+    {
+        const Vec3 sphereCenter(0, 0, 50);
+        const double sphereRadius = 10.0;
+
+        int stateCounts[5] = {0, 0, 0, 0, 0};
+        int orbitsCompleted = 0;
+        int orbiting = 0;
+        double radialErrorSum = 0.0;
+        double radialErrorMax = 0.0;
+        double speedSum = 0.0;
+        int retired = 0;
+
+        for (ECE_UAV* uav : uavs)
+        {
+            if (uav->isRetired())
+            {
+                retired++;
+                continue;
+            }
+            FlightState state = uav->getFlightState();
+            stateCounts[static_cast<int>(state)]++;
+            if (uav->hasCompletedOrbit())
+            {
+                orbitsCompleted++;
+            }
+            speedSum += uav->getVelocity().magnitude();
+
+            if (state == FlightState::ORBIT)
+            {
+                double radialError = std::fabs(uav->getPosition().distance(sphereCenter) - sphereRadius);
+                radialErrorSum += radialError;
+                radialErrorMax = std::max(radialErrorMax, radialError);
+                orbiting++;
+            }
+        }
+
+        printf("Final state:\n");
+        for (int s = 0; s < 5; ++s)
+        {
+            printf("  %-9s %d\n", getFlightStateName(static_cast<FlightState>(s)), stateCounts[s]);
+        }
+        printf("  orbits completed   %d\n", orbitsCompleted);
+        const int inService = static_cast<int>(uavs.size()) - retired;
+        if (retired > 0)
+        {
+            printf("  retired   %d\n", retired);
+        }
+        printf("  mean speed         %.3f m/s\n", inService == 0 ? 0.0 : speedSum / inService);
+        if (orbiting > 0)
+        {
+            printf("  orbit radius error mean %.3f m, max %.3f m\n", radialErrorSum / orbiting, radialErrorMax);
+        }
+        printf("  state checksum     %016llx\n", static_cast<unsigned long long>(stateChecksum(swarmState)));
+    }
+}
+
+
+int main(int argc, char* argv[])
+{
+    ScenarioOptions options;
+    if (!parseOptions(argc, argv, options))
+    {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    const unsigned long long tickCount = static_cast<unsigned long long>(std::ceil(options.durationSeconds / options.timeStep));
+    setBroadphaseType(options.broadphase);
+    setUAVBoundingRadius(options.boundingRadius);
+    setRandomSeed(options.seed);
+    setContinuousCollision(options.continuousCollision);
+    if (options.mode == "compare-precision")
+    {
+        return runPrecisionComparison(buildFormation(options), tickCount, options.timeStep);
+    }
+
+    if (!options.eventLogPath.empty())
+    {
+        setEventSampling(EventCategory::STATE, options.logSampling[0]);
+        setEventSampling(EventCategory::COLLISION, options.logSampling[1]);
+        setEventSampling(EventCategory::DIAGNOSTIC, options.logSampling[2]);
+        if (!openEventLog(options.eventLogPath))
+        {
+            fprintf(stderr, "Cannot create event log %s\n", options.eventLogPath.c_str());
+            return 1;
+        }
+    }
+
+    // Build the fleet on the requested formation
+    std::vector<Vec3> formation = buildFormation(options);
+    SimClock simClock(options.timeStep, options.clockMode, options.warpFactor);
+    SwarmState swarmState(formation.size());
+    UavArena uavArena(formation.size());
+    std::vector<ECE_UAV*> uavs;
+    uavs.reserve(formation.size());
+    GLOBAL_UAV_LIST = &uavs;
+    for (const Vec3& position : formation)
+    {
+        uavs.push_back(uavArena.create(swarmState, simClock, position));
+    }
+
+    printf("Scenario: %d UAVs, %s formation, seed %u, %.1f s simulated in %.0f ms steps, broadphase %s, %s collision, clock %s, integrator %s\n",
+           options.uavCount, options.formation.c_str(), options.seed,
+           options.durationSeconds, options.timeStep * 1000.0, getBroadphaseTypeName(options.broadphase),
+           options.continuousCollision ? "swept" : "discrete", getSimClockModeName(options.clockMode),
+           getIntegratorTypeName(options.integrator));
+
+    // Step the requested simulated duration on this thread, paced by the clock mode
+    switch (options.integrator)
+    {
+        case IntegratorType::SEMI_IMPLICIT_EULER:
+            stepScenario<SemiImplicitEulerIntegrator>(options, swarmState, simClock, uavs, uavArena, tickCount);
+            break;
+        case IntegratorType::VELOCITY_VERLET:
+            stepScenario<VelocityVerletIntegrator>(options, swarmState, simClock, uavs, uavArena, tickCount);
+            break;
+        case IntegratorType::RK4:
+            stepScenario<Rk4Integrator>(options, swarmState, simClock, uavs, uavArena, tickCount);
+            break;
+        case IntegratorType::CONSTANT_ACCELERATION:
+        default:
+            stepScenario<ConstantAccelerationIntegrator>(options, swarmState, simClock, uavs, uavArena, tickCount);
+            break;
+    }
+    printFinalState(uavs, swarmState);
+
+    if (isEventLogOpen())
+    {
+        closeEventLog();
+        EventLogStats logStats = getEventLogStats();
+        printf("Event log: %llu records written to %s, %llu sampled out, %llu dropped\n",
+               logStats.written, options.eventLogPath.c_str(), logStats.sampledOut, logStats.dropped);
+    }
+
+    // The arena destroys the UAVs on return
+    GLOBAL_UAV_LIST = nullptr;
+    uavs.clear();
+
+    return 0;
+}
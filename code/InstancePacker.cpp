@@ -0,0 +1,65 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Implementation of the GL-free UAV instance packer.
+*/
+
+#include "InstancePacker.h"
+#include <algorithm>
+#include <cmath>
+
+InstancePacker::InstancePacker()
+{
+    std::fill(std::begin(groupScale), std::end(groupScale), 1.0f);
+    std::fill(std::begin(groupBegin), std::end(groupBegin), 0);
+    std::fill(std::begin(groupCount), std::end(groupCount), 0);
+}
+
+size_t InstancePacker::getModelGroup(uint32_t id)
+{
+    return (id < 5) ? 0 : (id < 10) ? 1 : 2;
+}
+
+/*
+Counting sort by group, then the closed form of the model matrix: rotateX(90)
+* rotateY(spin) has columns (c, s, 0), (0, 0, 1) and (s, -c, 0)
+*/
+void InstancePacker::pack(const SwarmSnapshot& snapshot, const std::vector<uint32_t>& ids, float spinAngle)
+{
+    std::fill(std::begin(groupCount), std::end(groupCount), 0);
+    for (uint32_t id : ids)
+    {
+        groupCount[getModelGroup(id)]++;
+    }
+    size_t next[kModelGroupCount];
+    size_t offset = 0;
+    for (size_t group = 0; group < kModelGroupCount; ++group)
+    {
+        groupBegin[group] = offset;
+        next[group] = offset;
+        offset += groupCount[group];
+    }
+    instances.resize(ids.size());
+
+    const float c = std::cos(spinAngle);
+    const float s = std::sin(spinAngle);
+    for (uint32_t id : ids)
+    {
+        const size_t group = getModelGroup(id);
+        const float scale = groupScale[group];
+        const Vec3& position = snapshot.positions[id];
+        const float columns[16] = {
+            c * scale, s * scale, 0.0f, 0.0f,
+            0.0f, 0.0f, scale, 0.0f,
+            s * scale, -c * scale, 0.0f, 0.0f,
+            static_cast<float>(position.x), static_cast<float>(position.y), static_cast<float>(position.z), 1.0f};
+
+        UavInstance& instance = instances[next[group]++];
+        std::copy(std::begin(columns), std::end(columns), instance.model);
+        instance.colorIntensity = snapshot.colorIntensity[id];
+        std::fill(std::begin(instance.padding), std::end(instance.padding), 0.0f);
+    }
+}
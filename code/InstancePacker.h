@@ -0,0 +1,69 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+CPU side of instanced UAV rendering, kept free of OpenGL so it can be checked
+without a GPU (uav_checks verify-instancing). Each frame packs one UavInstance
+per UAV in service (model matrix and colour intensity) into a single array,
+grouped by model, so the renderer uploads it into one instance buffer and
+issues one instanced draw per model group.
+
+The model matrix is the one the per-UAV draw loop built with glm:
+    M = translate(position) * rotateX(90 deg) * rotateY(spin) * scale(groupScale)
+stored column-major like glm::mat4.
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "SwarmStepper.h"
+
+// Model groups drawn by the renderer: suzanne, cube, chicken
+const size_t kModelGroupCount = 3;
+
+// Per-instance vertex attributes, 80 bytes so every matrix column is 16-byte aligned
+struct UavInstance
+{
+    float model[16];       // Column-major model matrix (attribute locations 3-6)
+    float colorIntensity;  // ECE6122 colour oscillation (attribute location 7)
+    float padding[3];
+};
+
+class InstancePacker
+{
+    public:
+        InstancePacker();
+
+        // Model group of a UAV id: 0 for ids 0-4, 1 for 5-9, 2 for the rest
+        static size_t getModelGroup(uint32_t id);
+
+        // Uniform scale that fits a group's mesh to the physics bounds
+        void setGroupScale(size_t group, float scale) { groupScale[group] = scale; }
+        float getGroupScale(size_t group) const { return groupScale[group]; }
+
+        /*
+        Pack the instances of one frame
+        Input:
+            - snapshot: Positions and colour intensities indexed by UAV id
+            - ids: UAVs to draw, each below the snapshot size
+            - spinAngle: Spin about the upright model axis (radians)
+        Instances come out grouped by model, in the order of ids within a group.
+        */
+        void pack(const SwarmSnapshot& snapshot, const std::vector<uint32_t>& ids, float spinAngle);
+
+        const UavInstance* getInstances() const { return instances.data(); }
+        size_t getInstanceCount() const { return instances.size(); }
+
+        // Range of a group's instances in getInstances()
+        size_t getGroupBegin(size_t group) const { return groupBegin[group]; }
+        size_t getGroupCount(size_t group) const { return groupCount[group]; }
+
+    private:
+        std::vector<UavInstance> instances;
+        float groupScale[kModelGroupCount];
+        size_t groupBegin[kModelGroupCount];
+        size_t groupCount[kModelGroupCount];
+};
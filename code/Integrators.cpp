@@ -0,0 +1,37 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Names of the integrator policies for the command line and reports.
+*/
+
+#include "Integrators.h"
+
+bool parseIntegratorType(const std::string& name, IntegratorType& type)
+{
+    const IntegratorType types[] = {IntegratorType::CONSTANT_ACCELERATION, IntegratorType::SEMI_IMPLICIT_EULER,
+                                    IntegratorType::VELOCITY_VERLET, IntegratorType::RK4};
+    for (IntegratorType candidate : types)
+    {
+        if (name == getIntegratorTypeName(candidate))
+        {
+            type = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* getIntegratorTypeName(IntegratorType type)
+{
+    switch (type)
+    {
+        case IntegratorType::SEMI_IMPLICIT_EULER: return "euler";
+        case IntegratorType::VELOCITY_VERLET:     return "verlet";
+        case IntegratorType::RK4:                 return "rk4";
+        case IntegratorType::CONSTANT_ACCELERATION:
+        default:                                  return "taylor";
+    }
+}
@@ -0,0 +1,216 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Integrator policies for the kinematics phase. BasicSwarmStepper takes one as a
+template parameter, so the update is chosen at compile time and the inner
+loop calls it directly, without virtual dispatch. Every policy advances UAVs
+[begin, end) of a swarm store by one step under an acceleration model:
+    a = acceleration(id, position, velocity)
+It keeps the position before the step in prevPx/prevPy/prevPz for the swept
+collision test, stores the acceleration at the start of the step and applies
+the ground clamp at z = 0 to the result.
+
+The stepper's model holds the control force over the step (HeldControlForce):
+the flight controller samples once per tick, like a real autopilot. Under a
+constant acceleration the constant-acceleration update is exact, so Verlet and
+RK4 can only pay off when the model depends on the state within the step
+(see uav_checks bench-integrators).
+    - ConstantAccelerationIntegrator: x += v*dt + a*dt^2/2, v += a*dt (the
+      original update; integrate() runs the SIMD kernel of the store)
+    - SemiImplicitEulerIntegrator: v += a*dt, then x += v*dt
+    - VelocityVerletIntegrator: x += v*dt + a*dt^2/2, then v += (a + a')*dt/2
+      with a' evaluated at the new position and the predicted velocity
+    - Rk4Integrator: classic fourth-order Runge-Kutta on (x, v)
+*/
+
+#pragma once
+#include <cstddef>
+#include <string>
+#include "SwarmState.h"
+#include "Vec3.h"
+
+enum class IntegratorType
+{
+    CONSTANT_ACCELERATION, // Original update (default)
+    SEMI_IMPLICIT_EULER,
+    VELOCITY_VERLET,
+    RK4
+};
+
+const size_t kIntegratorTypeCount = 4;
+
+/*
+Parse an integrator name ("taylor", "euler", "verlet", "rk4")
+Input:
+    - name: Integrator name
+    - type: Set to the parsed integrator on success
+Output: true if the name is known
+*/
+bool parseIntegratorType(const std::string& name, IntegratorType& type);
+
+// Name of an integrator type, inverse of parseIntegratorType
+const char* getIntegratorTypeName(IntegratorType type);
+
+// Acceleration under the control force stored for this tick, held over the step
+template <typename T>
+struct HeldControlForce
+{
+    explicit HeldControlForce(const BasicSwarmState<T>& state) : state(state) {}
+
+    BasicVec3<T> operator()(size_t id, const BasicVec3<T>&, const BasicVec3<T>&) const
+    {
+        // Newton's second law with gravity acting on z
+        return BasicVec3<T>(state.fx[id] / state.mass[id], state.fy[id] / state.mass[id],
+                            (state.fz[id] - state.gravityCompensation[id]) / state.mass[id]);
+    }
+
+    const BasicSwarmState<T>& state;
+};
+
+namespace IntegratorDetail
+{
+    // Store the result of one UAV's step, with the ground clamp applied
+    template <typename T>
+    inline void store(BasicSwarmState<T>& state, size_t id, const BasicVec3<T>& start,
+                      BasicVec3<T> position, BasicVec3<T> velocity, const BasicVec3<T>& acceleration)
+    {
+        if (position.z < 0)
+        {
+            position.z = 0;
+            if (velocity.z < 0) velocity.z = 0;
+        }
+        state.prevPx[id] = start.x;
+        state.prevPy[id] = start.y;
+        state.prevPz[id] = start.z;
+        state.setPosition(id, position);
+        state.setVelocity(id, velocity);
+        state.ax[id] = acceleration.x;
+        state.ay[id] = acceleration.y;
+        state.az[id] = acceleration.z;
+    }
+}
+
+struct ConstantAccelerationIntegrator
+{
+    static const IntegratorType type = IntegratorType::CONSTANT_ACCELERATION;
+
+    template <typename T, typename Acceleration>
+    static void step(BasicSwarmState<T>& state, size_t begin, size_t end, double deltaTime,
+                     const Acceleration& acceleration)
+    {
+        const T dt = static_cast<T>(deltaTime);
+        const T halfDeltaTimeSq = T(0.5) * dt * dt;
+        for (size_t i = begin; i < end; ++i)
+        {
+            const BasicVec3<T> x0 = state.getPosition(i);
+            const BasicVec3<T> v0 = state.getVelocity(i);
+            const BasicVec3<T> a0 = acceleration(i, x0, v0);
+            IntegratorDetail::store(state, i, x0, x0 + (v0 * dt + a0 * halfDeltaTimeSq), v0 + a0 * dt, a0);
+        }
+    }
+
+    // Same update under the held control force, in the store's SIMD kernel
+    template <typename T>
+    static void integrate(BasicSwarmState<T>& state, size_t begin, size_t end, double deltaTime)
+    {
+        state.integrate(begin, end, deltaTime);
+    }
+};
+
+struct SemiImplicitEulerIntegrator
+{
+    static const IntegratorType type = IntegratorType::SEMI_IMPLICIT_EULER;
+
+    template <typename T, typename Acceleration>
+    static void step(BasicSwarmState<T>& state, size_t begin, size_t end, double deltaTime,
+                     const Acceleration& acceleration)
+    {
+        const T dt = static_cast<T>(deltaTime);
+        for (size_t i = begin; i < end; ++i)
+        {
+            const BasicVec3<T> x0 = state.getPosition(i);
+            const BasicVec3<T> v0 = state.getVelocity(i);
+            const BasicVec3<T> a0 = acceleration(i, x0, v0);
+            const BasicVec3<T> v1 = v0 + a0 * dt;
+            IntegratorDetail::store(state, i, x0, x0 + v1 * dt, v1, a0);
+        }
+    }
+
+    template <typename T>
+    static void integrate(BasicSwarmState<T>& state, size_t begin, size_t end, double deltaTime)
+    {
+        step(state, begin, end, deltaTime, HeldControlForce<T>(state));
+    }
+};
+
+struct VelocityVerletIntegrator
+{
+    static const IntegratorType type = IntegratorType::VELOCITY_VERLET;
+
+    template <typename T, typename Acceleration>
+    static void step(BasicSwarmState<T>& state, size_t begin, size_t end, double deltaTime,
+                     const Acceleration& acceleration)
+    {
+        const T dt = static_cast<T>(deltaTime);
+        const T halfDeltaTime = T(0.5) * dt;
+        const T halfDeltaTimeSq = halfDeltaTime * dt;
+        for (size_t i = begin; i < end; ++i)
+        {
+            const BasicVec3<T> x0 = state.getPosition(i);
+            const BasicVec3<T> v0 = state.getVelocity(i);
+            const BasicVec3<T> a0 = acceleration(i, x0, v0);
+            const BasicVec3<T> x1 = x0 + (v0 * dt + a0 * halfDeltaTimeSq);
+
+            // Velocity-dependent models see the explicit prediction v0 + a0*dt
+            const BasicVec3<T> a1 = acceleration(i, x1, v0 + a0 * dt);
+            IntegratorDetail::store(state, i, x0, x1, v0 + (a0 + a1) * halfDeltaTime, a0);
+        }
+    }
+
+    template <typename T>
+    static void integrate(BasicSwarmState<T>& state, size_t begin, size_t end, double deltaTime)
+    {
+        step(state, begin, end, deltaTime, HeldControlForce<T>(state));
+    }
+};
+
+struct Rk4Integrator
+{
+    static const IntegratorType type = IntegratorType::RK4;
+
+    template <typename T, typename Acceleration>
+    static void step(BasicSwarmState<T>& state, size_t begin, size_t end, double deltaTime,
+                     const Acceleration& acceleration)
+    {
+        const T dt = static_cast<T>(deltaTime);
+        const T halfDeltaTime = T(0.5) * dt;
+        const T sixthDeltaTime = dt / T(6);
+        for (size_t i = begin; i < end; ++i)
+        {
+            const BasicVec3<T> x0 = state.getPosition(i);
+            const BasicVec3<T> v0 = state.getVelocity(i);
+
+            // Slopes of (x, v): position slopes are velocities, velocity slopes accelerations
+            const BasicVec3<T> a1 = acceleration(i, x0, v0);
+            const BasicVec3<T> v2 = v0 + a1 * halfDeltaTime;
+            const BasicVec3<T> a2 = acceleration(i, x0 + v0 * halfDeltaTime, v2);
+            const BasicVec3<T> v3 = v0 + a2 * halfDeltaTime;
+            const BasicVec3<T> a3 = acceleration(i, x0 + v2 * halfDeltaTime, v3);
+            const BasicVec3<T> v4 = v0 + a3 * dt;
+            const BasicVec3<T> a4 = acceleration(i, x0 + v3 * dt, v4);
+
+            const BasicVec3<T> x1 = x0 + (v0 + (v2 + v3) * T(2) + v4) * sixthDeltaTime;
+            const BasicVec3<T> v1 = v0 + (a1 + (a2 + a3) * T(2) + a4) * sixthDeltaTime;
+            IntegratorDetail::store(state, i, x0, x1, v1, a1);
+        }
+    }
+
+    template <typename T>
+    static void integrate(BasicSwarmState<T>& state, size_t begin, size_t end, double deltaTime)
+    {
+        step(state, begin, end, deltaTime, HeldControlForce<T>(state));
+    }
+};
@@ -0,0 +1,128 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Implementation of the log-linear latency histogram.
+*/
+
+#include "LatencyHistogram.h"
+#include <algorithm>
+
+namespace
+{
+    // Index of the highest set bit (value != 0)
+    unsigned highestSetBit(uint64_t value)
+    {
+        unsigned bit = 0;
+        while (value >>= 1)
+        {
+            ++bit;
+        }
+        return bit;
+    }
+}
+
+LatencyHistogram::LatencyHistogram()
+    : buckets(kSubBucketCount + (kMaxValueBits - kSubBucketBits + 1) * kHalfSubBucketCount),
+      count(0), total(0), maxValue(0)
+{
+    reset();
+}
+
+/*
+Exact below kSubBucketCount; above, the top kSubBucketBits bits of the value
+select one of kHalfSubBucketCount sub-buckets of its power of two
+*/
+size_t LatencyHistogram::bucketIndex(uint64_t value)
+{
+    if (value < kSubBucketCount)
+    {
+        return static_cast<size_t>(value);
+    }
+    const uint64_t maxRecordable = (uint64_t(1) << kMaxValueBits) - 1;
+    value = std::min(value, maxRecordable);
+
+    const unsigned shift = highestSetBit(value) - kSubBucketBits + 1;
+    const uint64_t subBucket = value >> shift; // in [kHalfSubBucketCount, kSubBucketCount)
+    return static_cast<size_t>(kSubBucketCount + (shift - 1) * kHalfSubBucketCount +
+                               (subBucket - kHalfSubBucketCount));
+}
+
+uint64_t LatencyHistogram::bucketUpperBound(size_t index)
+{
+    if (index < kSubBucketCount)
+    {
+        return index;
+    }
+    const uint64_t offset = index - kSubBucketCount;
+    const unsigned shift = static_cast<unsigned>(offset / kHalfSubBucketCount) + 1;
+    const uint64_t subBucket = kHalfSubBucketCount + offset % kHalfSubBucketCount;
+    return ((subBucket + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(uint64_t microseconds)
+{
+    // Single writer: plain load/store pairs avoid locked read-modify-writes
+    std::atomic<uint64_t>& bucket = buckets[bucketIndex(microseconds)];
+    bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    total.store(total.load(std::memory_order_relaxed) + microseconds, std::memory_order_relaxed);
+    if (microseconds > maxValue.load(std::memory_order_relaxed))
+    {
+        maxValue.store(microseconds, std::memory_order_relaxed);
+    }
+    count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+void LatencyHistogram::reset()
+{
+    for (std::atomic<uint64_t>& bucket : buckets)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    count.store(0);
+    total.store(0);
+    maxValue.store(0);
+}
+
+double LatencyHistogram::getMean() const
+{
+    const uint64_t recorded = getCount();
+    return recorded > 0 ? static_cast<double>(total.load(std::memory_order_relaxed)) / recorded : 0.0;
+}
+
+uint64_t LatencyHistogram::getPercentile(double percentile) const
+{
+    const uint64_t recorded = count.load(std::memory_order_acquire);
+    if (recorded == 0)
+    {
+        return 0;
+    }
+
+    // Rank of the requested value, 1-based
+    const double clamped = std::min(100.0, std::max(0.0, percentile));
+    const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(clamped / 100.0 * recorded + 0.5));
+
+    uint64_t seen = 0;
+    for (size_t index = 0; index < buckets.size(); ++index)
+    {
+        seen += buckets[index].load(std::memory_order_relaxed);
+        if (seen >= rank)
+        {
+            return std::min(bucketUpperBound(index), getMax());
+        }
+    }
+    return getMax();
+}
+
+void LatencyHistogram::print(FILE* out, const char* label) const
+{
+    fprintf(out, "%s: %llu samples, mean %.1f us, p50 %llu us, p90 %llu us, p99 %llu us, p99.9 %llu us, max %llu us\n",
+            label, static_cast<unsigned long long>(getCount()), getMean(),
+            static_cast<unsigned long long>(getPercentile(50.0)),
+            static_cast<unsigned long long>(getPercentile(90.0)),
+            static_cast<unsigned long long>(getPercentile(99.0)),
+            static_cast<unsigned long long>(getPercentile(99.9)),
+            static_cast<unsigned long long>(getMax()));
+}
@@ -0,0 +1,61 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+HDR-style latency histogram with log-linear buckets: values below 128 us are
+counted exactly, above that every power of two is split into 64 sub-buckets,
+so any recorded value is reproduced within 1.6% up to about 12 days. Recording
+is a few shifts and relaxed atomic stores, done by a single writer thread;
+any other thread may query percentiles while it runs.
+*/
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+class LatencyHistogram
+{
+    public:
+        LatencyHistogram();
+
+        LatencyHistogram(const LatencyHistogram&) = delete;
+        LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+        // Record one value in microseconds (single writer)
+        void record(uint64_t microseconds);
+
+        // Drop all recorded values (single writer)
+        void reset();
+
+        uint64_t getCount() const { return count.load(std::memory_order_relaxed); }
+        uint64_t getMax() const { return maxValue.load(std::memory_order_relaxed); }
+        double getMean() const;
+
+        /*
+        Value at a percentile
+        Input: percentile - 0 to 100
+        Output: Upper bound of the bucket holding that rank (microseconds)
+        */
+        uint64_t getPercentile(double percentile) const;
+
+        // One line: count, mean, p50/p90/p99/p99.9 and max
+        void print(FILE* out, const char* label) const;
+
+    private:
+        static const unsigned kSubBucketBits = 7;
+        static const uint64_t kSubBucketCount = uint64_t(1) << kSubBucketBits;
+        static const uint64_t kHalfSubBucketCount = kSubBucketCount / 2;
+        static const unsigned kMaxValueBits = 40;
+
+        static size_t bucketIndex(uint64_t value);
+        static uint64_t bucketUpperBound(size_t index);
+
+        std::vector<std::atomic<uint64_t>> buckets;
+        std::atomic<uint64_t> count;
+        std::atomic<uint64_t> total;
+        std::atomic<uint64_t> maxValue;
+};
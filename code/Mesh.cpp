@@ -0,0 +1,100 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Implementation of the VAO-backed static mesh.
+*/
+
+#include "Mesh.h"
+#include <cstddef>
+#include "InstancePacker.h"
+
+Mesh::Mesh()
+    : vao(0), vbo(0), ebo(0), vertexCount(0), indexCount(0), indexType(GL_UNSIGNED_SHORT)
+{
+}
+
+void Mesh::upload(const std::vector<MeshVertex>& vertices, const std::vector<unsigned int>& indices)
+{
+    vertexCount = static_cast<GLsizei>(vertices.size());
+    indexCount = static_cast<GLsizei>(indices.size());
+    indexType = (getIndexSize(vertices.size()) == sizeof(uint16_t)) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+
+    glGenVertexArrays(1, &vao);
+    glBindVertexArray(vao);
+
+    glGenBuffers(1, &vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(MeshVertex), vertices.data(), GL_STATIC_DRAW);
+
+    // Position, half-float UV and packed normal, interleaved
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(MeshVertex), (void*)offsetof(MeshVertex, position));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_HALF_FLOAT, GL_FALSE, sizeof(MeshVertex), (void*)offsetof(MeshVertex, uv));
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof(MeshVertex), (void*)offsetof(MeshVertex, normal));
+
+    // The element buffer binding is part of the VAO
+    if (!indices.empty())
+    {
+        const std::vector<uint8_t> indexBytes = packIndices(indices, vertices.size());
+        glGenBuffers(1, &ebo);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexBytes.size(), indexBytes.data(), GL_STATIC_DRAW);
+    }
+
+    glBindVertexArray(0);
+}
+
+void Mesh::attachInstances(GLuint instanceBuffer)
+{
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+
+    // Model matrix columns (3-6) and colour intensity (7)
+    for (GLuint column = 0; column < 4; ++column)
+    {
+        glEnableVertexAttribArray(3 + column);
+        glVertexAttribPointer(3 + column, 4, GL_FLOAT, GL_FALSE, sizeof(UavInstance),
+                              (void*)(offsetof(UavInstance, model) + column * 4 * sizeof(float)));
+        glVertexAttribDivisor(3 + column, 1);
+    }
+    glEnableVertexAttribArray(7);
+    glVertexAttribPointer(7, 1, GL_FLOAT, GL_FALSE, sizeof(UavInstance), (void*)offsetof(UavInstance, colorIntensity));
+    glVertexAttribDivisor(7, 1);
+
+    glBindVertexArray(0);
+}
+
+void Mesh::draw(GLenum mode) const
+{
+    glBindVertexArray(vao);
+    if (indexCount > 0)
+    {
+        glDrawElements(mode, indexCount, indexType, (void*)0);
+    }
+    else
+    {
+        glDrawArrays(mode, 0, vertexCount);
+    }
+}
+
+void Mesh::drawInstanced(GLsizei instanceCount) const
+{
+    glBindVertexArray(vao);
+    glDrawElementsInstanced(GL_TRIANGLES, indexCount, indexType, (void*)0, instanceCount);
+}
+
+void Mesh::release()
+{
+    glDeleteBuffers(1, &vbo);
+    if (ebo != 0)
+    {
+        glDeleteBuffers(1, &ebo);
+    }
+    glDeleteVertexArrays(1, &vao);
+    vao = vbo = ebo = 0;
+}
@@ -0,0 +1,59 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+A static mesh on the GPU: one interleaved MeshVertex buffer, an optional
+index buffer and a vertex array object recording the attribute layout, all
+built once at load time. Drawing binds the VAO and issues the draw, with no
+per-frame attribute setup.
+
+Meshes drawn instanced also record the UavInstance attributes (locations 3-7,
+divisor 1) of an instance buffer in their VAO. The renderer refills that
+buffer each frame; orphaning it keeps the buffer name the VAO refers to.
+
+GL objects are released explicitly with release(), before the context goes away.
+*/
+
+#pragma once
+#include <GL/glew.h>
+#include <vector>
+#include "VertexPacking.h"
+
+class Mesh
+{
+    public:
+        Mesh();
+
+        /*
+        Create the buffers and the VAO
+        Input:
+            - vertices: Interleaved vertices
+            - indices: Triangle indices, or empty to draw the vertices in order
+        Indices are stored as GL_UNSIGNED_SHORT when the vertex count allows, else GL_UNSIGNED_INT.
+        Leaves the VAO unbound.
+        */
+        void upload(const std::vector<MeshVertex>& vertices, const std::vector<unsigned int>& indices);
+
+        // GL_UNSIGNED_SHORT or GL_UNSIGNED_INT
+        GLenum getIndexType() const { return indexType; }
+
+        // Record per-instance UavInstance attributes from instanceBuffer in the VAO
+        void attachInstances(GLuint instanceBuffer);
+
+        // Bind the VAO and draw the whole mesh
+        void draw(GLenum mode) const;
+        void drawInstanced(GLsizei instanceCount) const;
+
+        // Delete the VAO and buffers
+        void release();
+
+    private:
+        GLuint vao;
+        GLuint vbo;
+        GLuint ebo;
+        GLsizei vertexCount;
+        GLsizei indexCount;
+        GLenum indexType;
+};
@@ -0,0 +1,153 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Implementation of the structure-of-arrays PID controller bank.
+*/
+
+#include "PIDBank.h"
+#include <algorithm>
+#include "SwarmState.h"
+
+/*
+Constructor: defaults match PIDController (Kp 1, integral limits +-100)
+*/
+template <typename T>
+BasicPIDBank<T>::BasicPIDBank(size_t capacity)
+    : defaultKp(1), defaultKi(0), defaultKd(0),
+      defaultIntegralMin(-100), defaultIntegralMax(100)
+{
+    reserve(capacity);
+}
+
+template <typename T>
+void BasicPIDBank<T>::reserve(size_t capacity)
+{
+    Array* arrays[] = {&kp, &ki, &kd, &integralMin, &integralMax, &integral, &previousError,
+                       &setpoint, &measurement, &output};
+    for (Array* array : arrays)
+    {
+        array->reserve(capacity);
+    }
+    activeMask.reserve(capacity);
+    resetMask.reserve(capacity);
+}
+
+template <typename T>
+size_t BasicPIDBank<T>::add()
+{
+    kp.push_back(defaultKp);
+    ki.push_back(defaultKi);
+    kd.push_back(defaultKd);
+    integralMin.push_back(defaultIntegralMin);
+    integralMax.push_back(defaultIntegralMax);
+
+    Array* zeroed[] = {&integral, &previousError, &setpoint, &measurement, &output};
+    for (Array* array : zeroed)
+    {
+        array->push_back(0);
+    }
+
+    activeMask.push_back(0);
+    resetMask.push_back(0);
+    return kp.size() - 1;
+}
+
+template <typename T>
+void BasicPIDBank<T>::setGains(T proportional, T integralGain, T derivative)
+{
+    defaultKp = proportional;
+    defaultKi = integralGain;
+    defaultKd = derivative;
+    std::fill(kp.begin(), kp.end(), proportional);
+    std::fill(ki.begin(), ki.end(), integralGain);
+    std::fill(kd.begin(), kd.end(), derivative);
+}
+
+template <typename T>
+void BasicPIDBank<T>::setGains(size_t lane, T proportional, T integralGain, T derivative)
+{
+    kp[lane] = proportional;
+    ki[lane] = integralGain;
+    kd[lane] = derivative;
+}
+
+template <typename T>
+void BasicPIDBank<T>::setIntegralLimits(T min, T max)
+{
+    defaultIntegralMin = min;
+    defaultIntegralMax = max;
+    std::fill(integralMin.begin(), integralMin.end(), min);
+    std::fill(integralMax.begin(), integralMax.end(), max);
+}
+
+template <typename T>
+void BasicPIDBank<T>::setIntegralLimits(size_t lane, T min, T max)
+{
+    integralMin[lane] = min;
+    integralMax[lane] = max;
+}
+
+/*
+Evaluate [begin, end) with the widest kernel the CPU supports
+*/
+template <typename T>
+void BasicPIDBank<T>::calculate(size_t begin, size_t end, double deltaTime)
+{
+    static const bool useAvx2 = SwarmState::isAvx2Supported();
+
+    if (useAvx2)
+    {
+        calculateAvx2(begin, end, deltaTime);
+    }
+    else
+    {
+        calculateScalar(begin, end, deltaTime);
+    }
+}
+
+/*
+Evaluate [begin, end) one lane at a time, same steps as PIDController::calculate
+*/
+template <typename T>
+void BasicPIDBank<T>::calculateScalar(size_t begin, size_t end, double deltaTime)
+{
+    const T dt = static_cast<T>(deltaTime);
+
+    for (size_t i = begin; i < end; ++i)
+    {
+        if (resetMask[i])
+        {
+            integral[i] = 0;
+            previousError[i] = 0;
+            resetMask[i] = 0;
+        }
+        if (!activeMask[i])
+        {
+            continue;
+        }
+
+        T error = setpoint[i] - measurement[i];
+        T proportionalTerm = kp[i] * error;
+
+        // Integral with anti-windup clamp
+        integral[i] += error * dt;
+        integral[i] = std::max(integralMin[i], std::min(integralMax[i], integral[i]));
+        T integralTerm = ki[i] * integral[i];
+
+        T derivative = 0;
+        if (dt > 0)
+        {
+            derivative = (error - previousError[i]) / dt;
+        }
+        T derivativeTerm = kd[i] * derivative;
+
+        previousError[i] = error;
+        output[i] = proportionalTerm + integralTerm + derivativeTerm;
+    }
+}
+
+template class BasicPIDBank<float>;
+template class BasicPIDBank<double>;
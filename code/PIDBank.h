@@ -0,0 +1,129 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Structure-of-arrays bank of PID controllers, one lane per UAV. Gains,
+anti-windup limits, integral and previous error of every controller live in
+separate 64-byte-aligned arrays, and calculate() evaluates a whole range of
+lanes in one pass (four lanes per AVX2 instruction when available). Each lane
+performs exactly the sequence of operations of PIDController::calculate, so a
+lane and a PIDController fed the same inputs produce bit-identical outputs.
+
+Lanes are driven through their input slots: write setpoint/measurement, run
+calculate() over the range, then read output. Inactive lanes are skipped and
+keep their state; a lane marked for reset starts its next evaluation from a
+zero integral and previous error.
+
+The bank is templated on the scalar type like BasicPIDController and matches
+the controller of the same type; the float bank runs eight lanes per AVX2
+instruction.
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "AlignedAllocator.h"
+#include "PhysicsScalar.h"
+
+template <typename T>
+class BasicPIDBank
+{
+    public:
+        using Array = std::vector<T, AlignedAllocator<T>>;
+
+        /*
+        Constructor
+        Input: capacity - number of lanes to reserve storage for
+        */
+        explicit BasicPIDBank(size_t capacity = 0);
+
+        // Reserve storage without adding lanes
+        void reserve(size_t capacity);
+
+        /*
+        Append an inactive lane with the bank-wide gains and integral limits
+        Output: Lane index
+        */
+        size_t add();
+
+        size_t size() const { return kp.size(); }
+
+        /*
+        Set the gains of every lane and of lanes added later
+        Input:
+            - proportional, integral, derivative: Kp, Ki, Kd
+        */
+        void setGains(T proportional, T integral, T derivative);
+
+        // Override the gains of one lane
+        void setGains(size_t lane, T proportional, T integral, T derivative);
+
+        // Set the anti-windup limits of every lane and of lanes added later
+        void setIntegralLimits(T min, T max);
+
+        // Override the anti-windup limits of one lane
+        void setIntegralLimits(size_t lane, T min, T max);
+
+        // Include or skip a lane in calculate()
+        void setActive(size_t lane, bool active) { activeMask[lane] = active ? 1 : 0; }
+        bool isActive(size_t lane) const { return activeMask[lane] != 0; }
+
+        // Clear the lane's integral and previous error before its next evaluation
+        void reset(size_t lane) { resetMask[lane] = 1; }
+
+        // Input and output slots of a lane
+        void setInput(size_t lane, T setpointValue, T processVariable)
+        {
+            setpoint[lane] = setpointValue;
+            measurement[lane] = processVariable;
+        }
+        T getOutput(size_t lane) const { return output[lane]; }
+
+        /*
+        Evaluate the active lanes [begin, end)
+        Input:
+            - begin, end: Lane range; ranges evaluated in parallel must not overlap
+            - deltaTime: Time elapsed since the last update (seconds)
+        Runs the AVX2 kernel when the CPU supports it, the scalar loop otherwise.
+        */
+        void calculate(size_t begin, size_t end, double deltaTime);
+
+        // Portable one-lane-at-a-time kernel behind calculate()
+        void calculateScalar(size_t begin, size_t end, double deltaTime);
+
+        // Four double or eight float lanes per iteration, bit-identical to
+        // calculateScalar. Only call when SwarmState::isAvx2Supported() is true.
+        void calculateAvx2(size_t begin, size_t end, double deltaTime);
+
+        // Gains and anti-windup limits
+        Array kp, ki, kd;
+        Array integralMin, integralMax;
+
+        // Controller state
+        Array integral;
+        Array previousError;
+
+        // Per-tick input and output
+        Array setpoint, measurement;
+        Array output;
+
+        // Lane masks (0 or 1)
+        std::vector<uint8_t> activeMask;
+        std::vector<uint8_t> resetMask;
+
+    private:
+        // Values given to lanes added later
+        T defaultKp, defaultKi, defaultKd;
+        T defaultIntegralMin, defaultIntegralMax;
+};
+
+// AVX2 kernels, one per lane width (PIDBankAvx2.cpp)
+template <>
+void BasicPIDBank<float>::calculateAvx2(size_t begin, size_t end, double deltaTime);
+template <>
+void BasicPIDBank<double>::calculateAvx2(size_t begin, size_t end, double deltaTime);
+
+typedef BasicPIDBank<PhysicsScalar> PIDBank;
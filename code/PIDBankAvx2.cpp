@@ -0,0 +1,162 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+AVX2 kernels for BasicPIDBank::calculate, four double or eight float lanes.
+Like the SwarmState integrator, only this function is compiled for AVX2 and it
+is selected at runtime through SwarmState::isAvx2Supported(). Every lane
+performs the scalar sequence of IEEE operations without FMA contraction, and
+the active/reset masks are applied with blends, so results are bit-identical
+to calculateScalar of the same type.
+*/
+
+#include "PIDBank.h"
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define PID_BANK_HAS_AVX2 1
+    #define PID_BANK_AVX2_TARGET __attribute__((target("avx2")))
+    #include <immintrin.h>
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #define PID_BANK_HAS_AVX2 1
+    #define PID_BANK_AVX2_TARGET
+    #include <immintrin.h>
+#else
+    #define PID_BANK_HAS_AVX2 0
+#endif
+
+#if PID_BANK_HAS_AVX2
+
+namespace
+{
+    // Widen four 0/1 mask bytes to four all-ones/all-zeros double lanes
+    PID_BANK_AVX2_TARGET
+    inline __m256d loadLaneMask(const uint8_t* mask)
+    {
+        int32_t bytes;
+        std::memcpy(&bytes, mask, sizeof(bytes));
+        const __m256i wide = _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(bytes));
+        return _mm256_castsi256_pd(_mm256_cmpgt_epi64(wide, _mm256_setzero_si256()));
+    }
+
+    // Widen eight 0/1 mask bytes to eight all-ones/all-zeros float lanes
+    PID_BANK_AVX2_TARGET
+    inline __m256 loadLaneMaskPs(const uint8_t* mask)
+    {
+        const __m256i wide = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(mask)));
+        return _mm256_castsi256_ps(_mm256_cmpgt_epi32(wide, _mm256_setzero_si256()));
+    }
+}
+
+/*
+Evaluate [begin, end) four lanes at a time; the remainder goes to the scalar loop
+*/
+template <>
+PID_BANK_AVX2_TARGET
+void BasicPIDBank<double>::calculateAvx2(size_t begin, size_t end, double deltaTime)
+{
+    const size_t lanes = 4;
+    const size_t vectorEnd = begin + (end - begin) / lanes * lanes;
+
+    const __m256d dt = _mm256_set1_pd(deltaTime);
+    const __m256d zero = _mm256_setzero_pd();
+    const bool useDerivative = deltaTime > 0;
+
+    for (size_t i = begin; i < vectorEnd; i += lanes)
+    {
+        const __m256d active = loadLaneMask(activeMask.data() + i);
+        const __m256d resetting = loadLaneMask(resetMask.data() + i);
+        std::memset(resetMask.data() + i, 0, lanes);
+
+        // Pending resets apply to every lane, active or not
+        const __m256d startIntegral = _mm256_blendv_pd(_mm256_loadu_pd(integral.data() + i), zero, resetting);
+        const __m256d startError = _mm256_blendv_pd(_mm256_loadu_pd(previousError.data() + i), zero, resetting);
+
+        const __m256d error = _mm256_sub_pd(_mm256_loadu_pd(setpoint.data() + i),
+                                            _mm256_loadu_pd(measurement.data() + i));
+        const __m256d proportionalTerm = _mm256_mul_pd(_mm256_loadu_pd(kp.data() + i), error);
+
+        // Integral with anti-windup clamp: min/max operand order matches std::min/std::max
+        __m256d newIntegral = _mm256_add_pd(startIntegral, _mm256_mul_pd(error, dt));
+        newIntegral = _mm256_max_pd(_mm256_min_pd(newIntegral, _mm256_loadu_pd(integralMax.data() + i)),
+                                    _mm256_loadu_pd(integralMin.data() + i));
+        const __m256d integralTerm = _mm256_mul_pd(_mm256_loadu_pd(ki.data() + i), newIntegral);
+
+        const __m256d derivative = useDerivative ? _mm256_div_pd(_mm256_sub_pd(error, startError), dt) : zero;
+        const __m256d derivativeTerm = _mm256_mul_pd(_mm256_loadu_pd(kd.data() + i), derivative);
+
+        const __m256d result = _mm256_add_pd(_mm256_add_pd(proportionalTerm, integralTerm), derivativeTerm);
+
+        // Inactive lanes keep their state and last output
+        _mm256_storeu_pd(integral.data() + i, _mm256_blendv_pd(startIntegral, newIntegral, active));
+        _mm256_storeu_pd(previousError.data() + i, _mm256_blendv_pd(startError, error, active));
+        _mm256_storeu_pd(output.data() + i, _mm256_blendv_pd(_mm256_loadu_pd(output.data() + i), result, active));
+    }
+
+    calculateScalar(vectorEnd, end, deltaTime);
+}
+
+/*
+Evaluate [begin, end) eight float lanes at a time, same steps as the double kernel
+*/
+template <>
+PID_BANK_AVX2_TARGET
+void BasicPIDBank<float>::calculateAvx2(size_t begin, size_t end, double deltaTime)
+{
+    const size_t lanes = 8;
+    const size_t vectorEnd = begin + (end - begin) / lanes * lanes;
+
+    const float deltaTimeF = static_cast<float>(deltaTime);
+    const __m256 dt = _mm256_set1_ps(deltaTimeF);
+    const __m256 zero = _mm256_setzero_ps();
+    const bool useDerivative = deltaTimeF > 0;
+
+    for (size_t i = begin; i < vectorEnd; i += lanes)
+    {
+        const __m256 active = loadLaneMaskPs(activeMask.data() + i);
+        const __m256 resetting = loadLaneMaskPs(resetMask.data() + i);
+        std::memset(resetMask.data() + i, 0, lanes);
+
+        const __m256 startIntegral = _mm256_blendv_ps(_mm256_loadu_ps(integral.data() + i), zero, resetting);
+        const __m256 startError = _mm256_blendv_ps(_mm256_loadu_ps(previousError.data() + i), zero, resetting);
+
+        const __m256 error = _mm256_sub_ps(_mm256_loadu_ps(setpoint.data() + i),
+                                           _mm256_loadu_ps(measurement.data() + i));
+        const __m256 proportionalTerm = _mm256_mul_ps(_mm256_loadu_ps(kp.data() + i), error);
+
+        __m256 newIntegral = _mm256_add_ps(startIntegral, _mm256_mul_ps(error, dt));
+        newIntegral = _mm256_max_ps(_mm256_min_ps(newIntegral, _mm256_loadu_ps(integralMax.data() + i)),
+                                    _mm256_loadu_ps(integralMin.data() + i));
+        const __m256 integralTerm = _mm256_mul_ps(_mm256_loadu_ps(ki.data() + i), newIntegral);
+
+        const __m256 derivative = useDerivative ? _mm256_div_ps(_mm256_sub_ps(error, startError), dt) : zero;
+        const __m256 derivativeTerm = _mm256_mul_ps(_mm256_loadu_ps(kd.data() + i), derivative);
+
+        const __m256 result = _mm256_add_ps(_mm256_add_ps(proportionalTerm, integralTerm), derivativeTerm);
+
+        _mm256_storeu_ps(integral.data() + i, _mm256_blendv_ps(startIntegral, newIntegral, active));
+        _mm256_storeu_ps(previousError.data() + i, _mm256_blendv_ps(startError, error, active));
+        _mm256_storeu_ps(output.data() + i, _mm256_blendv_ps(_mm256_loadu_ps(output.data() + i), result, active));
+    }
+
+    calculateScalar(vectorEnd, end, deltaTime);
+}
+
+#else
+
+// No AVX2 on this target: keep the symbols so callers link
+template <>
+void BasicPIDBank<float>::calculateAvx2(size_t begin, size_t end, double deltaTime)
+{
+    calculateScalar(begin, end, deltaTime);
+}
+
+template <>
+void BasicPIDBank<double>::calculateAvx2(size_t begin, size_t end, double deltaTime)
+{
+    calculateScalar(begin, end, deltaTime);
+}
+
+#endif
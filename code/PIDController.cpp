@@ -1,7 +1,7 @@
 /*
 Author: Dulani Wijayarathne
 Class: ECE6122
-Last Date Modified: November 29, 2025
+Last Date Modified: October 16, 2026
 
 Description:
 Implementation of PID Controller class. Provides proportional, integral, and derivative
@@ -14,24 +14,26 @@ control for maintaining UAV flight characteristics.
 /*
 Constructor: Initialize PID controller with gains
 */
-PIDController::PIDController(double proportional, double integral, double derivative)
+template <typename T>
+BasicPIDController<T>::BasicPIDController(T proportional, T integral, T derivative)
     : kp(proportional), ki(integral), kd(derivative),
-      integral(0.0), previousError(0.0),
-      integralMax(100.0), integralMin(-100.0)
+      integral(0), previousError(0),
+      integralMax(100), integralMin(-100)
 {
 }
 
 /*
 Calculate PID output based on error between setpoint and current value
 */
-double PIDController::calculate(double setpoint, double processVariable, double deltaTime)
+template <typename T>
+T BasicPIDController<T>::calculate(T setpoint, T processVariable, T deltaTime)
 {
     // Calculate error (difference between desired and actual)
-    double error = setpoint - processVariable;
+    T error = setpoint - processVariable;
     
     // Proportional term: Kp * error
     // Responds immediately to current error
-    double proportionalTerm = kp * error;
+    T proportionalTerm = kp * error;
     
     // Integral term: Ki * sum(error * dt)
     // Addresses persistent steady-state errors
@@ -40,22 +42,22 @@ double PIDController::calculate(double setpoint, double processVariable, double
     // Anti-windup: Clamp integral to prevent excessive accumulation
     integral = std::max(integralMin, std::min(integralMax, integral));
     
-    double integralTerm = ki * integral;
+    T integralTerm = ki * integral;
     
     // Derivative term: Kd * (error - previousError) / dt
     // Predicts future error and dampens oscillations
-    double derivative = 0.0;
+    T derivative = 0;
     if (deltaTime > 0) 
     {
         derivative = (error - previousError) / deltaTime;
     }
-    double derivativeTerm = kd * derivative;
+    T derivativeTerm = kd * derivative;
     
     // Store current error for next iteration
     previousError = error;
     
     // Calculate total control output
-    double output = proportionalTerm + integralTerm + derivativeTerm;
+    T output = proportionalTerm + integralTerm + derivativeTerm;
     
     return output;
 }
@@ -63,16 +65,18 @@ double PIDController::calculate(double setpoint, double processVariable, double
 /*
 Reset controller state - useful when switching control modes
 */
-void PIDController::reset()
+template <typename T>
+void BasicPIDController<T>::reset()
 {
-    integral = 0.0;
-    previousError = 0.0;
+    integral = 0;
+    previousError = 0;
 }
 
 /*
 Update PID gains during runtime
 */
-void PIDController::setGains(double proportional, double integral, double derivative)
+template <typename T>
+void BasicPIDController<T>::setGains(T proportional, T integral, T derivative)
 {
     kp = proportional;
     ki = integral;
@@ -82,8 +86,12 @@ void PIDController::setGains(double proportional, double integral, double deriva
 /*
 Set limits to prevent integral windup
 */
-void PIDController::setIntegralLimits(double min, double max)
+template <typename T>
+void BasicPIDController<T>::setIntegralLimits(T min, T max)
 {
     integralMin = min;
     integralMax = max;
 }
+
+template class BasicPIDController<float>;
+template class BasicPIDController<double>;
@@ -1,31 +1,34 @@
 /*
 Author: Dulani Wijayarathne
 Class: ECE6122
-Last Date Modified: November 29, 2025
+Last Date Modified: October 16, 2026
 
 Description:
 PID (Proportional-Integral-Derivative) Controller class for maintaining UAV flight path.
 This controller calculates corrective forces to minimize error between current state
-and desired setpoint.
+and desired setpoint. Templated on the scalar type; PIDController is the
+double-precision controller and BasicPIDController<float> the single-precision
+one (both are instantiated in PIDController.cpp).
 */
 
 #pragma once
 
-class PIDController 
+template <typename T>
+class BasicPIDController
 {
 private:
     // PID gains
-    double kp; // Proportional gain
-    double ki; // Integral gain
-    double kd; // Derivative gain
+    T kp; // Proportional gain
+    T ki; // Integral gain
+    T kd; // Derivative gain
     
     // State variables
-    double integral;        // Accumulated error over time
-    double previousError;   // Error from last update
+    T integral;        // Accumulated error over time
+    T previousError;   // Error from last update
     
     // Anti-windup limits for integral term
-    double integralMax;
-    double integralMin;
+    T integralMax;
+    T integralMin;
     
 public:
     /*
@@ -35,7 +38,7 @@ public:
         - integral: Ki gain (corrects based on accumulated error)
         - derivative: Kd gain (corrects based on rate of error change)
     */
-    PIDController(double proportional = 1.0, double integral = 0.0, double derivative = 0.0);
+    BasicPIDController(T proportional = 1, T integral = 0, T derivative = 0);
     
     /*
     Calculate PID control output
@@ -46,7 +49,7 @@ public:
     Output:
         - Control signal to apply to system
     */
-    double calculate(double setpoint, double processVariable, double deltaTime);
+    T calculate(T setpoint, T processVariable, T deltaTime);
     
     /*
     Reset the PID controller state
@@ -61,7 +64,7 @@ public:
         - integral: New Ki value
         - derivative: New Kd value
     */
-    void setGains(double proportional, double integral, double derivative);
+    void setGains(T proportional, T integral, T derivative);
     
     /*
     Set limits for integral term to prevent windup
@@ -69,5 +72,7 @@ public:
         - min: Minimum integral value
         - max: Maximum integral value
     */
-    void setIntegralLimits(double min, double max);
+    void setIntegralLimits(T min, T max);
 };
+
+typedef BasicPIDController<double> PIDController;
@@ -1,7 +1,7 @@
 /*
 Author: Matt Chung
 Class: ECE6122
-Last Date Modified: November 29, 2025
+Last Date Modified: October 16, 2026
 
 Description:
 Global physics parameters and functions for UAV simulation.
@@ -9,9 +9,11 @@ Global physics parameters and functions for UAV simulation.
 
 #include "PhysicsGlobals.h"
 #include "ECE_UAV.h"
-#include <iostream>
+#include "SwarmState.h"
+#include "EventLog.h"
 #include <atomic>
 #include <algorithm>
+#include <cmath>
 
 // Define the global UAV list pointer
 std::vector<ECE_UAV*>* GLOBAL_UAV_LIST = nullptr;
@@ -19,68 +21,256 @@ std::vector<ECE_UAV*>* GLOBAL_UAV_LIST = nullptr;
 const double collisionThreshold = 0.01; // 1 centimeter clearance
 static std::atomic<double> gBoundingRadius(0.1); // Default 10 cm radius (20 cm cube)
 
+// Selected broadphase backend and the pair list it fills every tick
+static std::unique_ptr<Broadphase> gBroadphase = createBroadphase(BroadphaseType::SPATIAL_HASH);
+static BroadphaseType gBroadphaseType = BroadphaseType::SPATIAL_HASH;
+static std::vector<CollisionPair> gCollisionPairs;
+
+// Narrowphase result per candidate pair and the coloured contacts of this tick
+static std::vector<uint8_t> gContactFlags;
+static std::vector<CollisionPair> gContacts;
+static ContactColoring gContactColoring;
+static std::atomic<unsigned long long> gCollisionCount(0);
+static std::atomic<uint64_t> gRandomSeed(1);
+static std::atomic<bool> gContinuousCollision(true);
+
 void setUAVBoundingRadius(double radius)
 {
     double safeRadius = std::max(radius, 0.01);
     gBoundingRadius.store(safeRadius);
 }
 
+double getCollisionTriggerDistance()
+{
+    return (2.0 * gBoundingRadius.load()) + collisionThreshold;
+}
 
-void checkCollisionsFor(ECE_UAV* me)
+void setRandomSeed(uint64_t seed)
 {
-    if (GLOBAL_UAV_LIST == nullptr)
+    gRandomSeed.store(seed);
+}
+
+uint64_t getRandomSeed()
+{
+    return gRandomSeed.load();
+}
+
+void setBroadphaseType(BroadphaseType type)
+{
+    gBroadphase = createBroadphase(type);
+    gBroadphaseType = type;
+}
+
+BroadphaseType getBroadphaseType()
+{
+    return gBroadphaseType;
+}
+
+void setContinuousCollision(bool enabled)
+{
+    gContinuousCollision.store(enabled);
+}
+
+bool isContinuousCollisionEnabled()
+{
+    return gContinuousCollision.load();
+}
+
+void updateCollisionBroadphase(const SwarmState& state)
+{
+    // A fully sleeping swarm has no candidate pairs
+    if (state.sleepingCount == state.size())
     {
-        return; // No UAVs to check against
+        gCollisionPairs.clear();
+        gContactFlags.clear();
+        return;
     }
 
-    Vec3 myPos = me-> getPosition();
+    double searchDistance = (2.0 * gBoundingRadius.load()) + collisionThreshold;
+    if (gContinuousCollision.load())
+    {
+        // Two UAVs that met during the step are at most the sum of their
+        // displacements further apart at its end
+        double maxDisplacementSq = 0.0;
+        for (size_t i = 0; i < state.size(); ++i)
+        {
+            Vec3 displacement = state.getPosition(i) - state.getPreviousPosition(i);
+            maxDisplacementSq = std::max(maxDisplacementSq, displacement.dot(displacement));
+        }
+        searchDistance += 2.0 * std::sqrt(maxDisplacementSq);
+    }
+    gBroadphase->findPairs(state, searchDistance, gCollisionPairs);
+    gContactFlags.resize(gCollisionPairs.size());
+}
+
+size_t getCollisionPairCount()
+{
+    return gCollisionPairs.size();
+}
+
+unsigned long long getCollisionCount()
+{
+    return gCollisionCount.load();
+}
 
-    for (ECE_UAV* other : *GLOBAL_UAV_LIST) 
+void findCollisionContacts(const SwarmState& state, size_t begin, size_t end)
+{
+    const double triggerDistance = (2.0 * gBoundingRadius.load()) + collisionThreshold;
+    const bool continuous = gContinuousCollision.load();
+    end = std::min(end, gCollisionPairs.size());
+    for (size_t k = begin; k < end; ++k)
     {
-        if (me == other) continue; // skip self collision check
+        const CollisionPair& pair = gCollisionPairs[k];
+        if (state.retired[pair.a] || state.retired[pair.b])
+        {
+            gContactFlags[k] = 0; // Out of service, so not part of the airspace
+        }
+        else if (continuous)
+        {
+            double timeOfImpact;
+            gContactFlags[k] = findTimeOfImpact(state, pair.a, pair.b, triggerDistance, timeOfImpact) ? 1 : 0;
+        }
+        else
+        {
+            double distance = state.getPosition(pair.a).distance(state.getPosition(pair.b));
+            gContactFlags[k] = distance < triggerDistance ? 1 : 0;
+        }
+    }
+}
+
+/*
+Relative motion over the step is taken as linear, d(t) = d0 + (d1 - d0) t, so
+the first contact is the smaller root of |d(t)|^2 = triggerDistance^2
+*/
+bool findTimeOfImpact(const SwarmState& state, size_t a, size_t b, double triggerDistance, double& timeOfImpact)
+{
+    const Vec3 start = state.getPreviousPosition(a) - state.getPreviousPosition(b);
+    const Vec3 end = state.getPosition(a) - state.getPosition(b);
+    const Vec3 motion = end - start;
+    const double triggerSq = triggerDistance * triggerDistance;
+    const double startGap = start.dot(start) - triggerSq;
+    const double approach = start.dot(motion); // negative while closing in
 
-        Vec3 otherPos = other-> getPosition();
-        double distance = myPos.distance(otherPos);
-        double boundingRadius = gBoundingRadius.load();
-        const double triggerDistance = (2.0 * boundingRadius) + collisionThreshold;
-        if (distance < triggerDistance)
+    timeOfImpact = 0.0;
+    if (startGap < 0.0)
+    {
+        // Already in contact: still colliding unless the pair is moving apart
+        return end.dot(end) < triggerSq || approach < 0.0;
+    }
+
+    const double motionSq = motion.dot(motion);
+    if (approach >= 0.0 || motionSq <= 0.0)
+    {
+        return false;
+    }
+
+    const double discriminant = approach * approach - motionSq * startGap;
+    if (discriminant < 0.0)
+    {
+        return false; // Closest approach stays outside the trigger distance
+    }
+
+    timeOfImpact = (-approach - std::sqrt(discriminant)) / motionSq;
+    return timeOfImpact <= 1.0;
+}
+
+void colorCollisionContacts(size_t uavCount)
+{
+    gContacts.clear();
+    for (size_t k = 0; k < gCollisionPairs.size(); ++k)
+    {
+        if (gContactFlags[k])
         {
-            // Swap velocities
-            {
-                // Lock both UAVs' data mutexes
-                std::unique_lock<std::mutex> uavLock1(me->dataMutex, std::defer_lock);
-                std::unique_lock<std::mutex> uavLock2(other->dataMutex, std::defer_lock);
-
-                // Lock both UAVs' mutexes without deadlock
-                std::lock(uavLock1, uavLock2);
-
-                // Update positions inside lock to avoid stale data
-                myPos = me->position;
-                otherPos = other->position;
-
-                // Swap velocities
-                Vec3 dummyVel = me->velocity;
-                me->velocity = other->velocity;
-                other->velocity = dummyVel;
-
-                // Gently separate overlapping UAVs to reduce repeat collisions
-                Vec3 separation = myPos - otherPos;
-                double separationMag = separation.magnitude();
-                Vec3 correctionDir = separationMag > 1e-6 ? separation / separationMag : Vec3(1, 0, 0);
-                double overlap = triggerDistance - separationMag;
-                if (overlap < 0.0)
-                {
-                    overlap = 0.0;
-                }
-                Vec3 correction = correctionDir * (overlap * 0.5);
-                me->position += correction;
-                other->position = other->position - correction;
-
-                // Optional: Print collision event (once per detection)
-                std::cout << "Collision detected between UAVs at positions: ("
-                            << myPos.x << ", " << myPos.y << ", " << myPos.z << ") and ("
-                            << otherPos.x << ", " << otherPos.y << ", " << otherPos.z << ")\n";
-            }
+            gContacts.push_back(gCollisionPairs[k]);
         }
     }
-}
\ No newline at end of file
+    gContactColoring.build(gContacts, uavCount);
+}
+
+size_t getCollisionContactCount()
+{
+    return gContacts.size();
+}
+
+const std::vector<CollisionPair>& getCollisionContacts()
+{
+    return gContacts;
+}
+
+const ContactColoring& getContactColoring()
+{
+    return gContactColoring;
+}
+
+void resolveCollisionContacts(size_t begin, size_t end)
+{
+    if (GLOBAL_UAV_LIST == nullptr)
+    {
+        return; // No UAVs to resolve
+    }
+
+    std::vector<ECE_UAV*>& uavs = *GLOBAL_UAV_LIST;
+    end = std::min(end, gContacts.size());
+    for (size_t k = begin; k < end; ++k)
+    {
+        resolveCollisionPair(uavs[gContacts[k].a], uavs[gContacts[k].b]);
+    }
+}
+
+// Response for one pair found in contact by findCollisionContacts
+void resolveCollisionPair(ECE_UAV* me, ECE_UAV* other)
+{
+    const double triggerDistance = (2.0 * gBoundingRadius.load()) + collisionThreshold;
+
+    gCollisionCount.fetch_add(1, std::memory_order_relaxed);
+
+    // Current positions, including separations applied by earlier colours
+    SwarmState& state = me->state;
+    Vec3 myPos = state.getPosition(me->id);
+    Vec3 otherPos = state.getPosition(other->id);
+    Vec3 impactPos = myPos;
+
+    // A pair that met during the step collides at the time of impact: each UAV
+    // keeps its motion up to that point and takes over the other's afterwards,
+    // consistent with the velocity swap. The time is recomputed here so that
+    // separations applied by earlier colours are accounted for.
+    double timeOfImpact = 0.0;
+    if (gContinuousCollision.load() &&
+        findTimeOfImpact(state, me->id, other->id, triggerDistance, timeOfImpact) && timeOfImpact > 0.0)
+    {
+        Vec3 myStart = state.getPreviousPosition(me->id);
+        Vec3 otherStart = state.getPreviousPosition(other->id);
+        Vec3 myMotion = myPos - myStart;
+        Vec3 otherMotion = otherPos - otherStart;
+        impactPos = myStart + myMotion * timeOfImpact;
+        myPos = impactPos + otherMotion * (1.0 - timeOfImpact);
+        otherPos = otherStart + otherMotion * timeOfImpact + myMotion * (1.0 - timeOfImpact);
+
+        // The exchanged motion must respect the ground constraint as well
+        myPos.z = std::max(myPos.z, 0.0);
+        otherPos.z = std::max(otherPos.z, 0.0);
+    }
+
+    // Swap velocities
+    Vec3 dummyVel = state.getVelocity(me->id);
+    state.setVelocity(me->id, state.getVelocity(other->id));
+    state.setVelocity(other->id, dummyVel);
+
+    // Gently separate overlapping UAVs to reduce repeat collisions
+    Vec3 separation = myPos - otherPos;
+    double separationMag = separation.magnitude();
+    Vec3 correctionDir = separationMag > 1e-6 ? separation / separationMag : Vec3(1, 0, 0);
+    double overlap = triggerDistance - separationMag;
+    if (overlap < 0.0)
+    {
+        overlap = 0.0;
+    }
+    Vec3 correction = correctionDir * (overlap * 0.5);
+    state.setPosition(me->id, myPos + correction);
+    state.setPosition(other->id, otherPos - correction);
+
+    // Record the collision event (once per detection)
+    logEvent(EventKind::COLLISION, me->clock.getTick(),
+             static_cast<uint32_t>(me->id), static_cast<uint32_t>(other->id),
+             static_cast<float>(impactPos.x), static_cast<float>(impactPos.y), static_cast<float>(impactPos.z));
+}
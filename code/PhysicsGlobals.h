@@ -1,15 +1,20 @@
 /*
 Author: Matt Chung
 Class: ECE6122
-Last Date Modified: November 29, 2025
+Last Date Modified: October 16, 2026
 
 Description:
 Global physics parameters and functions for UAV simulation.
 */
 
 #pragma once
+#include <cstddef>
+#include <cstdint>
 #include <vector>
+#include "Broadphase.h"
+#include "ContactColoring.h"
 #include "ECE_UAV.h"
+#include "SwarmState.h"
 
 // Forward declaration to avoid circular dependency
 class ECE_UAV; 
@@ -17,8 +22,77 @@ class ECE_UAV;
 // A global pointer for accessing all UAVs in the simulation
 extern std::vector<ECE_UAV*>* GLOBAL_UAV_LIST;
 
-// Function to check for collisions between UAVs
-void checkCollisionsFor(ECE_UAV* me);
+// Select the collision broadphase backend. Call at startup, before stepping.
+void setBroadphaseType(BroadphaseType type);
+BroadphaseType getBroadphaseType();
+
+// Run the broadphase on the current positions and refill the shared pair list.
+// Call once per tick after integration and before findCollisionContacts. With
+// continuous collision the search distance grows by twice the largest step
+// displacement, so every pair that came close during the step is a candidate.
+void updateCollisionBroadphase(const SwarmState& state);
+
+// Number of candidate pairs found by the last updateCollisionBroadphase
+size_t getCollisionPairCount();
+
+// Total number of contacts resolved since startup
+unsigned long long getCollisionCount();
+
+// Narrowphase: flag the candidate pairs [begin, end) that are in contact.
+// With continuous collision a pair is in contact if the swept spheres met at
+// any time during the last step, otherwise only if they overlap at its end.
+// Pairs with a retired UAV are never in contact.
+// Reads positions only, safe to run in parallel batches.
+void findCollisionContacts(const SwarmState& state, size_t begin, size_t end);
+
+// Gather the flagged pairs into this tick's contact list and colour it (see
+// ContactColoring). Call once, after every findCollisionContacts batch.
+void colorCollisionContacts(size_t uavCount);
+
+// Number of contacts gathered by the last colorCollisionContacts
+size_t getCollisionContactCount();
+
+// Contacts gathered by the last colorCollisionContacts, in colour order
+const std::vector<CollisionPair>& getCollisionContacts();
+
+// Colour batches of the contact list
+const ContactColoring& getContactColoring();
+
+// Resolve contacts [begin, end) of the coloured contact list without locks.
+// A range must lie inside one colour batch (or be the serial group run on one thread).
+void resolveCollisionContacts(size_t begin, size_t end);
+
+// Velocity-swap and separation response for one pair of UAVs in contact; the
+// caller guarantees no other thread touches either UAV meanwhile. A pair that
+// met during the step swaps velocities at the time of impact and exchanges the
+// rest of its motion from there.
+void resolveCollisionPair(ECE_UAV* first, ECE_UAV* second);
+
+/*
+Swept-sphere test over the last integrated step
+Input:
+    - state: Swarm with current and previous positions
+    - a, b: UAV ids
+    - triggerDistance: Centre distance below which two UAVs collide
+    - timeOfImpact: Set to the fraction of the step [0, 1] at which the centres
+      first come within triggerDistance (0 if they already were)
+Output: true if the pair is in contact during the step; pairs that start in
+        contact and separate without ending in contact are not
+*/
+bool findTimeOfImpact(const SwarmState& state, size_t a, size_t b, double triggerDistance, double& timeOfImpact);
+
+// Enable the swept (continuous) collision test, on by default. Call at startup,
+// before stepping; off reverts to the instantaneous end-of-step distance test.
+void setContinuousCollision(bool enabled);
+bool isContinuousCollisionEnabled();
 
 // Configure the UAV collision bounding radius (in meters)
-void setUAVBoundingRadius(double radius);
\ No newline at end of file
+void setUAVBoundingRadius(double radius);
+
+// Centre distance below which two UAVs collide: two radii plus clearance
+double getCollisionTriggerDistance();
+
+// Seed of the per-UAV counter-based random streams. Call at startup, before
+// stepping; runs with the same seed and inputs reproduce the same trajectories.
+void setRandomSeed(uint64_t seed);
+uint64_t getRandomSeed();
\ No newline at end of file
@@ -0,0 +1,20 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Scalar type of the physics core. The state store, PID bank and flight
+controller are templates instantiated for float and double; this picks the
+instantiation the simulator runs. Configure with -DUAV_PHYSICS_FLOAT=ON to
+build the simulator in single precision (uav_sim_headless --mode
+compare-precision reports how far float trajectories drift from double).
+*/
+
+#pragma once
+
+#if defined(UAV_PHYSICS_FLOAT)
+typedef float PhysicsScalar;
+#else
+typedef double PhysicsScalar;
+#endif
@@ -0,0 +1,139 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Float against double flight of one formation, for
+uav_sim_headless --mode compare-precision.
+*/
+
+#include "PrecisionComparison.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include "FlightController.h"
+#include "SimClock.h"
+#include "SwarmState.h"
+#include "SwarmStepper.h"
+#include "WorkerPool.h"
+
+namespace
+{
+    double millisecondsSince(std::chrono::steady_clock::time_point start)
+    {
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+
+    // Simulated seconds between divergence reports
+    const double kPrecisionReportInterval = 10.0;
+
+    // One fleet of the precision comparison, stepped like SwarmStepper minus collisions
+    template <typename T>
+    struct PrecisionFleet
+    {
+        PrecisionFleet(const std::vector<Vec3>& formation, const SimClock& clock)
+            : state(formation.size()), controller(state, clock), stepMs(0.0)
+        {
+            for (const Vec3& position : formation)
+            {
+                // Same per-UAV setup as the ECE_UAV constructor
+                const size_t id = state.add(position, 1, 10);
+                state.radialControl.setGains(id, 8, T(0.2), 0);
+                state.radialControl.setIntegralLimits(id, -50, 50);
+                state.startTime[id] = clock.now();
+                state.orbitStartTime[id] = clock.now();
+            }
+            // Sleeping skips work without changing trajectories; integrate every UAV
+            controller.setSleepingEnabled(false);
+        }
+
+        void step(WorkerPool& pool, size_t batchSize, double deltaTime)
+        {
+            auto start = std::chrono::steady_clock::now();
+            controller.run(pool, batchSize, deltaTime);
+            pool.parallelFor(state.size(), batchSize, [&](size_t begin, size_t end)
+            {
+                state.integrate(begin, end, deltaTime);
+            });
+            stepMs += millisecondsSince(start);
+        }
+
+        // Mean and largest distance of ORBIT UAVs from the 10 m sphere
+        void orbitRadiusError(double& mean, double& max) const
+        {
+            const Vec3 sphereCenter(0, 0, 50);
+            double sum = 0.0;
+            size_t orbiting = 0;
+            max = 0.0;
+            for (size_t id = 0; id < state.size(); ++id)
+            {
+                if (state.flightState[id] == static_cast<uint8_t>(FlightState::ORBIT))
+                {
+                    const double error = std::fabs(Vec3(state.getPosition(id)).distance(sphereCenter) - 10.0);
+                    sum += error;
+                    max = std::max(max, error);
+                    orbiting++;
+                }
+            }
+            mean = orbiting > 0 ? sum / orbiting : 0.0;
+        }
+
+        BasicSwarmState<T> state;
+        BasicFlightController<T> controller;
+        double stepMs;
+    };
+}
+
+int runPrecisionComparison(const std::vector<Vec3>& formation, unsigned long long tickCount, double deltaTime)
+{
+    SimClock clock(deltaTime, SimClockMode::LOCKSTEP);
+    PrecisionFleet<double> wide(formation, clock);
+    PrecisionFleet<float> narrow(formation, clock);
+    WorkerPool pool;
+    const size_t batchSize = SwarmStepper::getDefaultBatchSize();
+    const unsigned long long reportTicks = std::max(1ull,
+        static_cast<unsigned long long>(std::llround(kPrecisionReportInterval / deltaTime)));
+
+    printf("Precision comparison: %zu UAVs, %llu ticks of %.0f ms, float against double, no collisions\n",
+           formation.size(), tickCount, deltaTime * 1000.0);
+    for (unsigned long long tick = 0; tick < tickCount; ++tick)
+    {
+        wide.step(pool, batchSize, deltaTime);
+        narrow.step(pool, batchSize, deltaTime);
+        clock.advance();
+
+        if ((tick + 1) % reportTicks != 0 && tick + 1 != tickCount)
+        {
+            continue;
+        }
+        double positionMax = 0.0, positionSum = 0.0, velocityMax = 0.0;
+        size_t stateMismatches = 0;
+        for (size_t id = 0; id < formation.size(); ++id)
+        {
+            const double positionError = wide.state.getPosition(id).distance(narrow.state.getPosition(id));
+            const double velocityError = wide.state.getVelocity(id).distance(narrow.state.getVelocity(id));
+            positionMax = std::max(positionMax, positionError);
+            positionSum += positionError;
+            velocityMax = std::max(velocityMax, velocityError);
+            stateMismatches += wide.state.flightState[id] != narrow.state.flightState[id] ? 1 : 0;
+        }
+        printf("  t = %6.1f s: position divergence mean %.3e m, max %.3e m; velocity max %.3e m/s; %zu UAVs in another state\n",
+               clock.now(), positionSum / formation.size(), positionMax, velocityMax, stateMismatches);
+    }
+
+    const char* const names[2] = {"double", "float"};
+    double radiusMean[2], radiusMax[2];
+    wide.orbitRadiusError(radiusMean[0], radiusMax[0]);
+    narrow.orbitRadiusError(radiusMean[1], radiusMax[1]);
+    const double stepMs[2] = {wide.stepMs, narrow.stepMs};
+    for (int precision = 0; precision < 2; ++precision)
+    {
+        printf("  %-6s orbit radius error mean %.3f m, max %.3f m; control and integration %.3f ms/tick\n",
+               names[precision], radiusMean[precision], radiusMax[precision],
+               tickCount > 0 ? stepMs[precision] / tickCount : 0.0);
+    }
+    return 0;
+}
@@ -0,0 +1,27 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Float against double comparison flown by
+uav_sim_headless --mode compare-precision.
+*/
+
+#pragma once
+#include <vector>
+#include "Vec3.h"
+
+/*
+Fly the same fleet in double and in float side by side, both driven by the
+templated flight controller and integrator from one simulated clock, and
+report how far the float trajectories drift from the double ones. Collisions
+are left out: both fleets follow their control laws only, so any divergence
+comes from the scalar type.
+Input:
+    - formation: Ground positions of the fleet
+    - tickCount: Ticks to simulate
+    - deltaTime: Time step (seconds)
+Output: 0 (measurements only)
+*/
+int runPrecisionComparison(const std::vector<Vec3>& formation, unsigned long long tickCount, double deltaTime);
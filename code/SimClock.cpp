@@ -0,0 +1,71 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Implementation of the fixed-step simulated clock.
+*/
+
+#include "SimClock.h"
+
+SimClock::SimClock(double timeStep, SimClockMode mode, double warpFactor)
+    : timeStep(timeStep), mode(mode),
+      warpFactor(mode == SimClockMode::REAL_TIME ? 1.0 : warpFactor),
+      ticks(0)
+{
+}
+
+double SimClock::now() const
+{
+    // Multiply instead of accumulating so long runs do not gather rounding error
+    return getTick() * timeStep;
+}
+
+double SimClock::getWarpFactor() const
+{
+    return mode == SimClockMode::LOCKSTEP ? 0.0 : warpFactor;
+}
+
+double SimClock::getPacingPeriod() const
+{
+    const double factor = getWarpFactor();
+    return factor > 0.0 ? timeStep / factor : 0.0;
+}
+
+void SimClock::advance()
+{
+    ticks.fetch_add(1, std::memory_order_acq_rel);
+}
+
+bool parseSimClockMode(const std::string& name, SimClockMode& mode)
+{
+    if (name == "lockstep")
+    {
+        mode = SimClockMode::LOCKSTEP;
+    }
+    else if (name == "realtime")
+    {
+        mode = SimClockMode::REAL_TIME;
+    }
+    else if (name == "warp")
+    {
+        mode = SimClockMode::TIME_WARP;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+const char* getSimClockModeName(SimClockMode mode)
+{
+    switch (mode)
+    {
+        case SimClockMode::LOCKSTEP:  return "lockstep";
+        case SimClockMode::REAL_TIME: return "realtime";
+        case SimClockMode::TIME_WARP: return "warp";
+    }
+    return "unknown";
+}
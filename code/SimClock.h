@@ -0,0 +1,75 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Simulated clock shared by the swarm. Simulation time advances by exactly one
+fixed time step per tick, independent of the wall clock; the pacing mode only
+decides the wall time the tick loop allots each tick (see TickScheduler):
+    - LOCKSTEP:  no waiting, ticks run back to back as fast as possible
+    - REAL_TIME: one tick per time step of wall time
+    - TIME_WARP: one tick per (time step / warp factor) of wall time
+*/
+
+#pragma once
+#include <atomic>
+#include <string>
+
+enum class SimClockMode
+{
+    LOCKSTEP,
+    REAL_TIME,
+    TIME_WARP
+};
+
+class SimClock
+{
+    public:
+        /*
+        Constructor
+        Input:
+            - timeStep: Simulated seconds per tick
+            - mode: Wall clock pacing of the tick loop
+            - warpFactor: Simulated seconds per wall second in TIME_WARP mode
+        */
+        explicit SimClock(double timeStep = 0.01, SimClockMode mode = SimClockMode::REAL_TIME,
+                          double warpFactor = 1.0);
+
+        SimClock(const SimClock&) = delete;
+        SimClock& operator=(const SimClock&) = delete;
+
+        // Simulated seconds since tick 0 (thread-safe)
+        double now() const;
+
+        // Ticks completed since construction (thread-safe)
+        unsigned long long getTick() const { return ticks.load(std::memory_order_acquire); }
+
+        double getTimeStep() const { return timeStep; }
+        SimClockMode getMode() const { return mode; }
+
+        // Simulated seconds per wall second, 0 for LOCKSTEP
+        double getWarpFactor() const;
+
+        // Wall seconds per tick under the pacing mode, 0 for LOCKSTEP
+        double getPacingPeriod() const;
+
+        // Advance simulated time by one time step. Called by the stepper only.
+        void advance();
+
+    private:
+        const double timeStep;
+        const SimClockMode mode;
+        const double warpFactor;
+
+        std::atomic<unsigned long long> ticks;
+};
+
+/*
+Parse a clock mode name (lockstep, realtime, warp)
+Output: false if the name is unknown
+*/
+bool parseSimClockMode(const std::string& name, SimClockMode& mode);
+
+// Name of a clock mode as accepted by parseSimClockMode
+const char* getSimClockModeName(SimClockMode mode);
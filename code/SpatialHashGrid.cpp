@@ -0,0 +1,88 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Implementation of the uniform-grid spatial hash broadphase.
+*/
+
+#include "SpatialHashGrid.h"
+#include <algorithm>
+
+SpatialHashGrid::SpatialHashGrid(double cellSize)
+    : cellSize(1.0), inverseCellSize(1.0), itemCount(0), bucketMask(0)
+{
+    setCellSize(cellSize);
+    bucketStart.assign(2, 0);
+}
+
+void SpatialHashGrid::setCellSize(double size)
+{
+    cellSize = std::max(size, 1e-6);
+    inverseCellSize = 1.0 / cellSize;
+}
+
+/*
+Counting-sort rebuild: bin -> prefix sum -> scatter
+*/
+template <typename Scalar>
+void SpatialHashGrid::rebuild(const Scalar* px, const Scalar* py, const Scalar* pz, size_t count)
+{
+    itemCount = count;
+
+    // Hash table with at least twice as many buckets as items (power of two)
+    size_t bucketCount = 16;
+    while (bucketCount < 2 * count)
+    {
+        bucketCount <<= 1;
+    }
+    bucketMask = static_cast<uint32_t>(bucketCount - 1);
+
+    // resize() only allocates while the fleet grows
+    cellX.resize(count);
+    cellY.resize(count);
+    cellZ.resize(count);
+    itemBucket.resize(count);
+    sortedItems.resize(count);
+    bucketStart.resize(bucketCount + 1);
+    std::fill(bucketStart.begin(), bucketStart.end(), 0u);
+
+    // Pass 1: cell coordinates and bucket histogram
+    for (size_t i = 0; i < count; ++i)
+    {
+        const int32_t x = static_cast<int32_t>(std::floor(px[i] * inverseCellSize));
+        const int32_t y = static_cast<int32_t>(std::floor(py[i] * inverseCellSize));
+        const int32_t z = static_cast<int32_t>(std::floor(pz[i] * inverseCellSize));
+        cellX[i] = x;
+        cellY[i] = y;
+        cellZ[i] = z;
+
+        const uint32_t bucket = hashCell(x, y, z);
+        itemBucket[i] = bucket;
+        bucketStart[bucket + 1]++;
+    }
+
+    // Pass 2: exclusive prefix sum gives each bucket's first slot
+    for (size_t b = 0; b < bucketCount; ++b)
+    {
+        bucketStart[b + 1] += bucketStart[b];
+    }
+
+    // Pass 3: scatter items in id order; each bucket's start advances to its end
+    for (size_t i = 0; i < count; ++i)
+    {
+        const uint32_t slot = bucketStart[itemBucket[i]]++;
+        sortedItems[slot] = static_cast<uint32_t>(i);
+    }
+
+    // Every start now holds the next bucket's start; shift back by one
+    for (size_t b = bucketCount; b > 0; --b)
+    {
+        bucketStart[b] = bucketStart[b - 1];
+    }
+    bucketStart[0] = 0;
+}
+
+template void SpatialHashGrid::rebuild<float>(const float*, const float*, const float*, size_t);
+template void SpatialHashGrid::rebuild<double>(const double*, const double*, const double*, size_t);
@@ -0,0 +1,106 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Uniform-grid spatial hash used as the collision broadphase. Items are binned
+into cubic cells with a counting sort, so a rebuild is linear in the number of
+UAVs and does not allocate once the buffers have grown to the fleet size.
+Neighbour queries visit the 27 cells around an item.
+*/
+
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class SpatialHashGrid
+{
+    public:
+        /*
+        Constructor
+        Input: cellSize - edge length of a grid cell (meters)
+        */
+        explicit SpatialHashGrid(double cellSize = 1.0);
+
+        // Change the cell edge length; takes effect on the next rebuild
+        void setCellSize(double cellSize);
+        double getCellSize() const { return cellSize; }
+
+        /*
+        Rebuild the grid from SoA positions with a counting sort
+        Input:
+            - px, py, pz: Position arrays (float or double)
+            - count: Number of items (item id == array index)
+        */
+        template <typename Scalar>
+        void rebuild(const Scalar* px, const Scalar* py, const Scalar* pz, size_t count);
+
+        // Number of items in the last rebuild
+        size_t size() const { return itemCount; }
+
+        /*
+        Visit every item in the 27 cells around item id (excluding id itself)
+        Input:
+            - id: Item to query around
+            - visit: Callable taking the neighbour id (size_t)
+        */
+        template <typename Visitor>
+        void forEachNeighbour(size_t id, Visitor&& visit) const
+        {
+            const int32_t baseX = cellX[id];
+            const int32_t baseY = cellY[id];
+            const int32_t baseZ = cellZ[id];
+
+            for (int32_t dz = -1; dz <= 1; ++dz)
+            {
+                for (int32_t dy = -1; dy <= 1; ++dy)
+                {
+                    for (int32_t dx = -1; dx <= 1; ++dx)
+                    {
+                        const int32_t x = baseX + dx;
+                        const int32_t y = baseY + dy;
+                        const int32_t z = baseZ + dz;
+                        const uint32_t bucket = hashCell(x, y, z);
+
+                        for (uint32_t k = bucketStart[bucket]; k < bucketStart[bucket + 1]; ++k)
+                        {
+                            const uint32_t other = sortedItems[k];
+
+                            // Buckets are shared by hash collisions; only accept the queried cell
+                            if (other == id || cellX[other] != x || cellY[other] != y || cellZ[other] != z)
+                            {
+                                continue;
+                            }
+                            visit(static_cast<size_t>(other));
+                        }
+                    }
+                }
+            }
+        }
+
+    private:
+        uint32_t hashCell(int32_t x, int32_t y, int32_t z) const
+        {
+            const uint32_t h = (static_cast<uint32_t>(x) * 73856093u) ^
+                               (static_cast<uint32_t>(y) * 19349663u) ^
+                               (static_cast<uint32_t>(z) * 83492791u);
+            return h & bucketMask;
+        }
+
+        double cellSize;
+        double inverseCellSize;
+
+        size_t itemCount;
+        uint32_t bucketMask;
+
+        // Per-item cell coordinates and bucket
+        std::vector<int32_t> cellX, cellY, cellZ;
+        std::vector<uint32_t> itemBucket;
+
+        // Counting-sort output: items of bucket b are sortedItems[bucketStart[b] .. bucketStart[b+1])
+        std::vector<uint32_t> bucketStart;
+        std::vector<uint32_t> sortedItems;
+};
@@ -0,0 +1,135 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Implementation of the epoch-reclaimed swarm membership list. Announcements,
+the pointer exchange and the epoch increment are sequentially consistent:
+reclamation relies on a single order between a reader's announcement and its
+pointer load on one side and the writer's exchange and epoch scan on the other.
+*/
+
+#include "SwarmMembership.h"
+
+SwarmMembership::SwarmMembership()
+    : current(new MembershipVersion()), globalEpoch(1), nextNumber(1), currentNumber(0),
+      publishedCount(0), reclaimedCount(0), pendingCount(0)
+{
+    for (ReaderSlot& slot : readers)
+    {
+        slot.epoch.store(0);
+        slot.inUse.store(false);
+    }
+}
+
+SwarmMembership::~SwarmMembership()
+{
+    for (const std::pair<const MembershipVersion*, unsigned long long>& entry : retired)
+    {
+        delete entry.first;
+    }
+    delete current.load();
+}
+
+size_t SwarmMembership::registerReader()
+{
+    for (size_t reader = 0; reader < kMaxMembershipReaders; ++reader)
+    {
+        bool expected = false;
+        if (readers[reader].inUse.compare_exchange_strong(expected, true))
+        {
+            return reader;
+        }
+    }
+    return kNoReader;
+}
+
+void SwarmMembership::unregisterReader(size_t reader)
+{
+    readers[reader].epoch.store(0);
+    readers[reader].inUse.store(false);
+}
+
+/*
+Announce before loading the pointer: a writer that later scans the slot sees
+an epoch no newer than any version this reader can hold
+*/
+SwarmMembership::ReadGuard::ReadGuard(const SwarmMembership& membership, size_t reader)
+    : membership(membership), reader(reader)
+{
+    membership.readers[reader].epoch.store(membership.globalEpoch.load());
+    version = membership.current.load();
+}
+
+SwarmMembership::ReadGuard::~ReadGuard()
+{
+    membership.readers[reader].epoch.store(0);
+}
+
+void SwarmMembership::publish(std::vector<uint32_t> ids)
+{
+    MembershipVersion* version = new MembershipVersion();
+    version->number = nextNumber++;
+    version->ids = std::move(ids);
+
+    // Readers that announce the new epoch load the pointer after the exchange
+    const MembershipVersion* previous = current.exchange(version);
+    currentNumber.store(version->number);
+    const unsigned long long retireEpoch = globalEpoch.fetch_add(1) + 1;
+    retired.push_back(std::make_pair(previous, retireEpoch));
+    publishedCount.fetch_add(1, std::memory_order_relaxed);
+
+    reclaim();
+}
+
+void SwarmMembership::reclaim()
+{
+    if (retired.empty())
+    {
+        return;
+    }
+
+    // Oldest announced epoch among readers inside a read section
+    unsigned long long oldest = 0;
+    for (const ReaderSlot& slot : readers)
+    {
+        const unsigned long long epoch = slot.epoch.load();
+        if (epoch != 0 && (oldest == 0 || epoch < oldest))
+        {
+            oldest = epoch;
+        }
+    }
+
+    size_t kept = 0;
+    unsigned long long freed = 0;
+    for (const std::pair<const MembershipVersion*, unsigned long long>& entry : retired)
+    {
+        if (oldest == 0 || oldest >= entry.second)
+        {
+            delete entry.first;
+            freed++;
+        }
+        else
+        {
+            retired[kept++] = entry;
+        }
+    }
+    retired.resize(kept);
+    reclaimedCount.fetch_add(freed, std::memory_order_relaxed);
+    pendingCount.store(kept, std::memory_order_relaxed);
+}
+
+unsigned long long SwarmMembership::getVersionNumber() const
+{
+    return currentNumber.load();
+}
+
+MembershipStats SwarmMembership::getStats() const
+{
+    MembershipStats result;
+    result.published = publishedCount.load(std::memory_order_relaxed);
+    result.reclaimed = reclaimedCount.load(std::memory_order_relaxed);
+    result.pending = pendingCount.load(std::memory_order_relaxed);
+    return result;
+}
@@ -0,0 +1,133 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Read-copy-update list of the UAV ids currently flying. The writer (the swarm
+stepper, between ticks) publishes each change as a new immutable version with
+one atomic exchange; readers on any thread walk the version they picked up
+without locks while later versions are published.
+
+Old versions are freed by epoch-based reclamation. Every registered reader
+announces the global epoch while it holds a version (0 when it holds none).
+Publishing retires the replaced version tagged with the epoch after the
+exchange, and a retired version is freed once every reader is quiescent or
+has announced that epoch or a later one: such readers loaded the pointer after
+the exchange and cannot hold it. A reader that stalls inside a read section
+only delays reclamation, never the writer.
+*/
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "AlignedAllocator.h"
+
+// Most threads that can be registered as readers at once
+const size_t kMaxMembershipReaders = 16;
+
+// One published membership list, never modified after publishing
+struct MembershipVersion
+{
+    unsigned long long number = 0; // 0 for the initial empty list, +1 per publish
+    std::vector<uint32_t> ids;     // Active UAV ids in ascending order
+};
+
+// Publishing and reclamation counters
+struct MembershipStats
+{
+    unsigned long long published = 0; // Versions published since start
+    unsigned long long reclaimed = 0; // Retired versions freed
+    size_t pending = 0;               // Retired versions still waiting for readers
+};
+
+class SwarmMembership
+{
+    public:
+        // Reader slot handed out by registerReader()
+        static const size_t kNoReader = static_cast<size_t>(-1);
+
+        SwarmMembership();
+
+        // Frees every version; no reader may be inside a read section
+        ~SwarmMembership();
+
+        SwarmMembership(const SwarmMembership&) = delete;
+        SwarmMembership& operator=(const SwarmMembership&) = delete;
+
+        /*
+        Claim a reader slot for the calling thread (thread-safe)
+        Output: Slot to pass to ReadGuard, kNoReader if all slots are taken
+        */
+        size_t registerReader();
+
+        // Release a slot claimed by registerReader (outside any read section)
+        void unregisterReader(size_t reader);
+
+        /*
+        Pins the current version for the lifetime of the guard
+        Input:
+            - membership: List to read
+            - reader: Slot of the calling thread
+        Read sections of one slot must not nest or overlap.
+        */
+        class ReadGuard
+        {
+            public:
+                ReadGuard(const SwarmMembership& membership, size_t reader);
+                ~ReadGuard();
+
+                ReadGuard(const ReadGuard&) = delete;
+                ReadGuard& operator=(const ReadGuard&) = delete;
+
+                const MembershipVersion& get() const { return *version; }
+                const std::vector<uint32_t>& ids() const { return version->ids; }
+
+            private:
+                const SwarmMembership& membership;
+                size_t reader;
+                const MembershipVersion* version;
+        };
+
+        /*
+        Publish a new version (single writer thread only)
+        Input: ids - Active UAV ids in ascending order
+        Then frees the retired versions no reader can still hold.
+        */
+        void publish(std::vector<uint32_t> ids);
+
+        // Free the retired versions no reader can still hold (writer thread only)
+        void reclaim();
+
+        // Number of the current version (thread-safe)
+        unsigned long long getVersionNumber() const;
+
+        MembershipStats getStats() const;
+
+    private:
+        // Announced epoch of one reader on a line of its own
+        struct ReaderSlot
+        {
+            std::atomic<unsigned long long> epoch;
+            std::atomic<bool> inUse;
+            char padding[kCacheLineBytes];
+        };
+
+        std::atomic<const MembershipVersion*> current;
+        std::atomic<unsigned long long> globalEpoch; // Starts at 1; 0 marks a quiescent reader
+        char currentPadding[kCacheLineBytes];
+
+        // Written by readers through const guards
+        mutable ReaderSlot readers[kMaxMembershipReaders];
+
+        // Writer-owned: replaced versions and the epoch they were retired in
+        std::vector<std::pair<const MembershipVersion*, unsigned long long>> retired;
+        unsigned long long nextNumber;
+        std::atomic<unsigned long long> currentNumber; // Readable without pinning a version
+        std::atomic<unsigned long long> publishedCount;
+        std::atomic<unsigned long long> reclaimedCount;
+        std::atomic<size_t> pendingCount;
+};
@@ -0,0 +1,178 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Implementation of the structure-of-arrays swarm state store.
+*/
+
+#include "SwarmState.h"
+
+template <typename T>
+BasicSwarmState<T>::BasicSwarmState(size_t capacity)
+{
+    reserve(capacity);
+}
+
+template <typename T>
+void BasicSwarmState<T>::reserve(size_t capacity)
+{
+    Array* arrays[] = {&px, &py, &pz, &prevPx, &prevPy, &prevPz, &vx, &vy, &vz, &ax, &ay, &az,
+                       &fx, &fy, &fz, &mass, &gravityCompensation,
+                       &directionX, &directionY, &directionZ, &colorPhase};
+    for (Array* array : arrays)
+    {
+        array->reserve(capacity);
+    }
+    TimeArray* times[] = {&startTime, &orbitStartTime, &nextDirectionTime, &wakeTime};
+    for (TimeArray* array : times)
+    {
+        array->reserve(capacity);
+    }
+    flightState.reserve(capacity);
+    directionDraws.reserve(capacity);
+    orbitCompleted.reserve(capacity);
+    asleep.reserve(capacity);
+    retired.reserve(capacity);
+    radialControl.reserve(capacity);
+}
+
+template <typename T>
+size_t BasicSwarmState<T>::add(const Vector& position, T uavMass, T uavGravityCompensation)
+{
+    px.push_back(position.x);
+    py.push_back(position.y);
+    pz.push_back(position.z);
+    prevPx.push_back(position.x);
+    prevPy.push_back(position.y);
+    prevPz.push_back(position.z);
+
+    Array* zeroed[] = {&vx, &vy, &vz, &ax, &ay, &az, &fx, &fy, &fz};
+    for (Array* array : zeroed)
+    {
+        array->push_back(0);
+    }
+
+    mass.push_back(uavMass);
+    gravityCompensation.push_back(uavGravityCompensation);
+
+    Array* controlZeroed[] = {&directionY, &directionZ, &colorPhase};
+    for (Array* array : controlZeroed)
+    {
+        array->push_back(0);
+    }
+    TimeArray* timesZeroed[] = {&startTime, &orbitStartTime, &nextDirectionTime, &wakeTime};
+    for (TimeArray* array : timesZeroed)
+    {
+        array->push_back(0.0);
+    }
+    directionX.push_back(1);
+    flightState.push_back(0);
+    directionDraws.push_back(0);
+    orbitCompleted.push_back(0);
+    asleep.push_back(0);
+    retired.push_back(0);
+    radialControl.add();
+    return px.size() - 1;
+}
+
+template <typename T>
+void BasicSwarmState<T>::reset(size_t id, const Vector& position, T uavMass, T uavGravityCompensation)
+{
+    setPosition(id, position);
+    prevPx[id] = position.x;
+    prevPy[id] = position.y;
+    prevPz[id] = position.z;
+
+    Array* zeroed[] = {&vx, &vy, &vz, &ax, &ay, &az, &fx, &fy, &fz, &directionY, &directionZ, &colorPhase};
+    for (Array* array : zeroed)
+    {
+        (*array)[id] = 0;
+    }
+
+    mass[id] = uavMass;
+    gravityCompensation[id] = uavGravityCompensation;
+
+    TimeArray* timesZeroed[] = {&startTime, &orbitStartTime, &nextDirectionTime, &wakeTime};
+    for (TimeArray* array : timesZeroed)
+    {
+        (*array)[id] = 0.0;
+    }
+    directionX[id] = 1;
+    flightState[id] = 0;
+    orbitCompleted[id] = 0;
+    radialControl.reset(id);
+    radialControl.setActive(id, false);
+}
+
+/*
+Integrate [begin, end) with the widest kernel the CPU supports
+*/
+template <typename T>
+void BasicSwarmState<T>::integrate(size_t begin, size_t end, double deltaTime)
+{
+    // CPUID is queried once; the answer cannot change while running
+    static const bool useAvx2 = isAvx2Supported();
+
+    if (useAvx2)
+    {
+        integrateAvx2(begin, end, deltaTime);
+    }
+    else
+    {
+        integrateScalar(begin, end, deltaTime);
+    }
+}
+
+/*
+Integrate [begin, end) over the SoA arrays, one UAV at a time
+*/
+template <typename T>
+void BasicSwarmState<T>::integrateScalar(size_t begin, size_t end, double deltaTime)
+{
+    const T dt = static_cast<T>(deltaTime);
+    const T halfDeltaTimeSq = T(0.5) * dt * dt;
+
+    for (size_t i = begin; i < end; ++i)
+    {
+        // Newton's second law with gravity acting on z
+        ax[i] = fx[i] / mass[i];
+        ay[i] = fy[i] / mass[i];
+        az[i] = (fz[i] - gravityCompensation[i]) / mass[i];
+
+        // x = x0 + v0*t + 0.5*a*t^2
+        prevPx[i] = px[i];
+        prevPy[i] = py[i];
+        prevPz[i] = pz[i];
+        px[i] += vx[i] * dt + ax[i] * halfDeltaTimeSq;
+        py[i] += vy[i] * dt + ay[i] * halfDeltaTimeSq;
+        pz[i] += vz[i] * dt + az[i] * halfDeltaTimeSq;
+
+        // v = v0 + a*t
+        vx[i] += ax[i] * dt;
+        vy[i] += ay[i] * dt;
+        vz[i] += az[i] * dt;
+
+        // Ground constraint
+        if (pz[i] < 0)
+        {
+            pz[i] = 0;
+            if (vz[i] < 0) vz[i] = 0;
+        }
+    }
+}
+
+template <typename T>
+void BasicSwarmState<T>::copyPositions(std::vector<Vec3>& out) const
+{
+    const size_t count = size();
+    out.resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        out[i] = Vec3(px[i], py[i], pz[i]);
+    }
+}
+
+template class BasicSwarmState<float>;
+template class BasicSwarmState<double>;
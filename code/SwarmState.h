@@ -0,0 +1,149 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Structure-of-arrays store for the kinematic and flight control state of the
+whole swarm. Each quantity is kept as separate, 64-byte-aligned x/y/z arrays
+indexed by UAV id so that control, integration, collision and rendering passes
+stream memory linearly. ECE_UAV objects are lightweight handles holding an id
+into this store.
+
+The store is templated on the scalar type of the physics quantities (position,
+velocity, force, orbit direction, PID state); simulated times stay double in
+every instantiation so deadlines do not lose resolution late in a run.
+SwarmState is the instantiation selected by PhysicsScalar.h.
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "AlignedAllocator.h"
+#include "PIDBank.h"
+#include "PhysicsScalar.h"
+#include "Vec3.h"
+
+template <typename T>
+class BasicSwarmState
+{
+    public:
+        using Array = std::vector<T, AlignedAllocator<T>>;
+        using TimeArray = std::vector<double, AlignedAllocator<double>>;
+        using Vector = BasicVec3<T>;
+
+        /*
+        Constructor
+        Input: capacity - number of UAVs to reserve storage for
+        */
+        explicit BasicSwarmState(size_t capacity = 0);
+
+        /*
+        Append a UAV at rest, IDLE since simulated time 0
+        Input:
+            - position: Initial position
+            - mass: UAV mass (kg)
+            - gravityCompensation: Magnitude of the downward gravity force (N)
+        Output: Id of the new UAV (index into every array)
+        */
+        size_t add(const Vector& position, T mass, T gravityCompensation);
+
+        /*
+        Put a retired id back into service with the state add() gives a new UAV
+        Input: Same as add()
+        The random stream counter (directionDraws) carries on, so the reused
+        slot never replays the draws of its previous flight. The asleep and
+        retired flags are left to the flight controller (FlightController::launch).
+        */
+        void reset(size_t id, const Vector& position, T mass, T gravityCompensation);
+
+        // Reserve storage without adding UAVs
+        void reserve(size_t capacity);
+
+        size_t size() const { return px.size(); }
+
+        // Per-UAV accessors (no synchronisation, callers provide it)
+        Vector getPosition(size_t id) const { return Vector(px[id], py[id], pz[id]); }
+        Vector getPreviousPosition(size_t id) const { return Vector(prevPx[id], prevPy[id], prevPz[id]); }
+        Vector getVelocity(size_t id) const { return Vector(vx[id], vy[id], vz[id]); }
+        Vector getAcceleration(size_t id) const { return Vector(ax[id], ay[id], az[id]); }
+        Vector getControlForce(size_t id) const { return Vector(fx[id], fy[id], fz[id]); }
+
+        void setPosition(size_t id, const Vector& p) { px[id] = p.x; py[id] = p.y; pz[id] = p.z; }
+        void setVelocity(size_t id, const Vector& v) { vx[id] = v.x; vy[id] = v.y; vz[id] = v.z; }
+        void setControlForce(size_t id, const Vector& f) { fx[id] = f.x; fy[id] = f.y; fz[id] = f.z; }
+
+        /*
+        Integrate the stored control force for UAVs [begin, end)
+        Input:
+            - begin, end: Id range
+            - deltaTime: Time step (seconds)
+        Same update as the per-UAV path: a = F/m, x += v*dt + a*dt^2/2,
+        v += a*dt, followed by the ground clamp at z = 0. The position before
+        the step is kept in prevPx/prevPy/prevPz for the swept collision
+        test. Runs the AVX2 kernel when the CPU supports it, the scalar loop
+        otherwise.
+        */
+        void integrate(size_t begin, size_t end, double deltaTime);
+
+        // Portable one-UAV-at-a-time kernel behind integrate()
+        void integrateScalar(size_t begin, size_t end, double deltaTime);
+
+        // Four double or eight float UAVs per iteration in 256-bit lanes,
+        // bit-identical to integrateScalar. Only call when isAvx2Supported() is true.
+        void integrateAvx2(size_t begin, size_t end, double deltaTime);
+
+        // Whether this build has the AVX2 kernel and the CPU can run it
+        static bool isAvx2Supported();
+
+        /*
+        Copy all positions into out (resized to size()), widened to double
+        */
+        void copyPositions(std::vector<Vec3>& out) const;
+
+        // Kinematic state
+        Array px, py, pz;
+        Array prevPx, prevPy, prevPz; // Position at the start of the last integrated step
+        Array vx, vy, vz;
+        Array ax, ay, az;
+
+        // Control force produced by the control phase for the current tick
+        Array fx, fy, fz;
+
+        // Per-UAV constants used by the integrator
+        Array mass;
+        Array gravityCompensation;
+
+        // Flight control state, advanced by FlightController
+        std::vector<uint8_t> flightState;      // FlightState value
+        TimeArray startTime;                   // Simulated time the flight timeline starts
+        TimeArray orbitStartTime;              // Simulated time ORBIT was entered
+        Array directionX, directionY, directionZ; // Random orbit direction (unit)
+        TimeArray nextDirectionTime;           // Simulated time of the next direction draw
+        std::vector<uint32_t> directionDraws;  // Draws taken from the UAV's random stream
+        Array colorPhase;                      // ECE6122 colour oscillation phase (radians)
+        std::vector<uint8_t> orbitCompleted;   // 1 once the 60 s orbit is done
+
+        // Sleeping bodies: at rest, skipped by integration and by sleeping-pair
+        // collision tests until their wake time or a contact (see FlightController)
+        std::vector<uint8_t> asleep;           // 1 while the UAV sleeps
+        TimeArray wakeTime;                    // Simulated time its controller must run again if at rest
+        size_t sleepingCount = 0;              // Number of UAVs with asleep set
+
+        // Retired UAVs sleep for good and take part in no contact until their
+        // slot is reused by a later launch (see SwarmStepper::requestRetire)
+        std::vector<uint8_t> retired;          // 1 while the slot is out of service
+        size_t retiredCount = 0;               // Number of UAVs with retired set (all also asleep)
+
+        // Orbit radial controller of every UAV, lane == UAV id
+        BasicPIDBank<T> radialControl;
+};
+
+// AVX2 kernels, one per lane width (SwarmStateAvx2.cpp)
+template <>
+void BasicSwarmState<float>::integrateAvx2(size_t begin, size_t end, double deltaTime);
+template <>
+void BasicSwarmState<double>::integrateAvx2(size_t begin, size_t end, double deltaTime);
+
+typedef BasicSwarmState<PhysicsScalar> SwarmState;
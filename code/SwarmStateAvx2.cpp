@@ -0,0 +1,236 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+AVX2 integration kernels for BasicSwarmState (four double or eight float
+lanes) and the CPUID check that selects them.
+Only the kernel function is compiled for AVX2 (function target attribute), so
+the rest of the program, including inline code shared with other translation
+units, still runs on CPUs without it. The kernel performs exactly the scalar
+sequence of IEEE operations per lane, without FMA contraction, so results are
+bit-identical to integrateScalar of the same type.
+*/
+
+#include "SwarmState.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define SWARM_STATE_HAS_AVX2 1
+    #define SWARM_STATE_AVX2_TARGET __attribute__((target("avx2")))
+    #include <immintrin.h>
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #define SWARM_STATE_HAS_AVX2 1
+    #define SWARM_STATE_AVX2_TARGET
+    #include <immintrin.h>
+    #include <intrin.h>
+#else
+    #define SWARM_STATE_HAS_AVX2 0
+#endif
+
+template <typename T>
+bool BasicSwarmState<T>::isAvx2Supported()
+{
+#if SWARM_STATE_HAS_AVX2 && defined(__GNUC__)
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#elif SWARM_STATE_HAS_AVX2
+    // Leaf 7 EBX bit 5 is AVX2; the OS must also save the YMM registers
+    int info[4];
+    __cpuid(info, 1);
+    const bool osSavesYmm = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+    __cpuidex(info, 7, 0);
+    return osSavesYmm && (info[1] & (1 << 5)) != 0;
+#else
+    return false;
+#endif
+}
+
+template bool BasicSwarmState<float>::isAvx2Supported();
+template bool BasicSwarmState<double>::isAvx2Supported();
+
+#if SWARM_STATE_HAS_AVX2
+
+/*
+Integrate [begin, end) four UAVs at a time; the remainder goes to the scalar loop
+*/
+template <>
+SWARM_STATE_AVX2_TARGET
+void BasicSwarmState<double>::integrateAvx2(size_t begin, size_t end, double deltaTime)
+{
+    const size_t lanes = 4;
+    const size_t vectorEnd = begin + (end - begin) / lanes * lanes;
+
+    const __m256d dt = _mm256_set1_pd(deltaTime);
+    const __m256d halfDtSq = _mm256_set1_pd(0.5 * deltaTime * deltaTime);
+    const __m256d zero = _mm256_setzero_pd();
+
+    double* const PX = px.data();
+    double* const PY = py.data();
+    double* const PZ = pz.data();
+    double* const QX = prevPx.data();
+    double* const QY = prevPy.data();
+    double* const QZ = prevPz.data();
+    double* const VX = vx.data();
+    double* const VY = vy.data();
+    double* const VZ = vz.data();
+    double* const AX = ax.data();
+    double* const AY = ay.data();
+    double* const AZ = az.data();
+    const double* const FX = fx.data();
+    const double* const FY = fy.data();
+    const double* const FZ = fz.data();
+    const double* const M = mass.data();
+    const double* const G = gravityCompensation.data();
+
+    // Batches start at arbitrary ids, so use unaligned loads and stores
+    for (size_t i = begin; i < vectorEnd; i += lanes)
+    {
+        const __m256d m = _mm256_loadu_pd(M + i);
+
+        // Newton's second law with gravity acting on z
+        const __m256d accelX = _mm256_div_pd(_mm256_loadu_pd(FX + i), m);
+        const __m256d accelY = _mm256_div_pd(_mm256_loadu_pd(FY + i), m);
+        const __m256d accelZ = _mm256_div_pd(_mm256_sub_pd(_mm256_loadu_pd(FZ + i), _mm256_loadu_pd(G + i)), m);
+        _mm256_storeu_pd(AX + i, accelX);
+        _mm256_storeu_pd(AY + i, accelY);
+        _mm256_storeu_pd(AZ + i, accelZ);
+
+        __m256d velX = _mm256_loadu_pd(VX + i);
+        __m256d velY = _mm256_loadu_pd(VY + i);
+        __m256d velZ = _mm256_loadu_pd(VZ + i);
+
+        // x = x0 + (v0*t + 0.5*a*t^2), same association as the scalar loop
+        const __m256d startX = _mm256_loadu_pd(PX + i);
+        const __m256d startY = _mm256_loadu_pd(PY + i);
+        const __m256d startZ = _mm256_loadu_pd(PZ + i);
+        _mm256_storeu_pd(QX + i, startX);
+        _mm256_storeu_pd(QY + i, startY);
+        _mm256_storeu_pd(QZ + i, startZ);
+        const __m256d posX = _mm256_add_pd(startX,
+                                           _mm256_add_pd(_mm256_mul_pd(velX, dt), _mm256_mul_pd(accelX, halfDtSq)));
+        const __m256d posY = _mm256_add_pd(startY,
+                                           _mm256_add_pd(_mm256_mul_pd(velY, dt), _mm256_mul_pd(accelY, halfDtSq)));
+        __m256d posZ = _mm256_add_pd(startZ,
+                                     _mm256_add_pd(_mm256_mul_pd(velZ, dt), _mm256_mul_pd(accelZ, halfDtSq)));
+
+        // v = v0 + a*t
+        velX = _mm256_add_pd(velX, _mm256_mul_pd(accelX, dt));
+        velY = _mm256_add_pd(velY, _mm256_mul_pd(accelY, dt));
+        velZ = _mm256_add_pd(velZ, _mm256_mul_pd(accelZ, dt));
+
+        // Ground constraint: lanes below z = 0 snap to +0 and lose downward
+        // velocity. Ordered compares keep NaN lanes untouched, like the scalar test.
+        const __m256d belowGround = _mm256_cmp_pd(posZ, zero, _CMP_LT_OQ);
+        const __m256d fallingBelow = _mm256_and_pd(belowGround, _mm256_cmp_pd(velZ, zero, _CMP_LT_OQ));
+        posZ = _mm256_blendv_pd(posZ, zero, belowGround);
+        velZ = _mm256_blendv_pd(velZ, zero, fallingBelow);
+
+        _mm256_storeu_pd(PX + i, posX);
+        _mm256_storeu_pd(PY + i, posY);
+        _mm256_storeu_pd(PZ + i, posZ);
+        _mm256_storeu_pd(VX + i, velX);
+        _mm256_storeu_pd(VY + i, velY);
+        _mm256_storeu_pd(VZ + i, velZ);
+    }
+
+    integrateScalar(vectorEnd, end, deltaTime);
+}
+
+/*
+Integrate [begin, end) eight float UAVs at a time, same steps as the double kernel
+*/
+template <>
+SWARM_STATE_AVX2_TARGET
+void BasicSwarmState<float>::integrateAvx2(size_t begin, size_t end, double deltaTime)
+{
+    const size_t lanes = 8;
+    const size_t vectorEnd = begin + (end - begin) / lanes * lanes;
+
+    const float deltaTimeF = static_cast<float>(deltaTime);
+    const __m256 dt = _mm256_set1_ps(deltaTimeF);
+    const __m256 halfDtSq = _mm256_set1_ps(0.5f * deltaTimeF * deltaTimeF);
+    const __m256 zero = _mm256_setzero_ps();
+
+    float* const PX = px.data();
+    float* const PY = py.data();
+    float* const PZ = pz.data();
+    float* const QX = prevPx.data();
+    float* const QY = prevPy.data();
+    float* const QZ = prevPz.data();
+    float* const VX = vx.data();
+    float* const VY = vy.data();
+    float* const VZ = vz.data();
+    float* const AX = ax.data();
+    float* const AY = ay.data();
+    float* const AZ = az.data();
+    const float* const FX = fx.data();
+    const float* const FY = fy.data();
+    const float* const FZ = fz.data();
+    const float* const M = mass.data();
+    const float* const G = gravityCompensation.data();
+
+    for (size_t i = begin; i < vectorEnd; i += lanes)
+    {
+        const __m256 m = _mm256_loadu_ps(M + i);
+
+        const __m256 accelX = _mm256_div_ps(_mm256_loadu_ps(FX + i), m);
+        const __m256 accelY = _mm256_div_ps(_mm256_loadu_ps(FY + i), m);
+        const __m256 accelZ = _mm256_div_ps(_mm256_sub_ps(_mm256_loadu_ps(FZ + i), _mm256_loadu_ps(G + i)), m);
+        _mm256_storeu_ps(AX + i, accelX);
+        _mm256_storeu_ps(AY + i, accelY);
+        _mm256_storeu_ps(AZ + i, accelZ);
+
+        __m256 velX = _mm256_loadu_ps(VX + i);
+        __m256 velY = _mm256_loadu_ps(VY + i);
+        __m256 velZ = _mm256_loadu_ps(VZ + i);
+
+        const __m256 startX = _mm256_loadu_ps(PX + i);
+        const __m256 startY = _mm256_loadu_ps(PY + i);
+        const __m256 startZ = _mm256_loadu_ps(PZ + i);
+        _mm256_storeu_ps(QX + i, startX);
+        _mm256_storeu_ps(QY + i, startY);
+        _mm256_storeu_ps(QZ + i, startZ);
+        const __m256 posX = _mm256_add_ps(startX,
+                                          _mm256_add_ps(_mm256_mul_ps(velX, dt), _mm256_mul_ps(accelX, halfDtSq)));
+        const __m256 posY = _mm256_add_ps(startY,
+                                          _mm256_add_ps(_mm256_mul_ps(velY, dt), _mm256_mul_ps(accelY, halfDtSq)));
+        __m256 posZ = _mm256_add_ps(startZ,
+                                    _mm256_add_ps(_mm256_mul_ps(velZ, dt), _mm256_mul_ps(accelZ, halfDtSq)));
+
+        velX = _mm256_add_ps(velX, _mm256_mul_ps(accelX, dt));
+        velY = _mm256_add_ps(velY, _mm256_mul_ps(accelY, dt));
+        velZ = _mm256_add_ps(velZ, _mm256_mul_ps(accelZ, dt));
+
+        const __m256 belowGround = _mm256_cmp_ps(posZ, zero, _CMP_LT_OQ);
+        const __m256 fallingBelow = _mm256_and_ps(belowGround, _mm256_cmp_ps(velZ, zero, _CMP_LT_OQ));
+        posZ = _mm256_blendv_ps(posZ, zero, belowGround);
+        velZ = _mm256_blendv_ps(velZ, zero, fallingBelow);
+
+        _mm256_storeu_ps(PX + i, posX);
+        _mm256_storeu_ps(PY + i, posY);
+        _mm256_storeu_ps(PZ + i, posZ);
+        _mm256_storeu_ps(VX + i, velX);
+        _mm256_storeu_ps(VY + i, velY);
+        _mm256_storeu_ps(VZ + i, velZ);
+    }
+
+    integrateScalar(vectorEnd, end, deltaTime);
+}
+
+#else
+
+// No AVX2 on this target: keep the symbols so callers link, isAvx2Supported() is false
+template <>
+void BasicSwarmState<float>::integrateAvx2(size_t begin, size_t end, double deltaTime)
+{
+    integrateScalar(begin, end, deltaTime);
+}
+
+template <>
+void BasicSwarmState<double>::integrateAvx2(size_t begin, size_t end, double deltaTime)
+{
+    integrateScalar(begin, end, deltaTime);
+}
+
+#endif
@@ -0,0 +1,421 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Implementation of the worker-pool swarm stepper.
+*/
+
+#include "SwarmStepper.h"
+#include "PhysicsGlobals.h"
+#include <algorithm>
+#include <chrono>
+
+namespace
+{
+    // Per-core L1 data cache budget used to size UAV batches
+    const size_t kL1CacheBytes = 32 * 1024;
+
+    // Bytes the integrator streams per UAV: position, previous position,
+    // velocity, acceleration and force (x/y/z), mass and gravity compensation
+    const size_t kIntegratedBytesPerUav = 17 * sizeof(PhysicsScalar);
+
+    double millisecondsSince(std::chrono::steady_clock::time_point start)
+    {
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+}
+
+/*
+Constructor: size the pool and batches, the tick loop is started by start()
+*/
+template <typename Integrator>
+BasicSwarmStepper<Integrator>::BasicSwarmStepper(SwarmState& state, SimClock& clock, std::vector<ECE_UAV*>& uavs,
+                                                 size_t threadCount, size_t batchSize)
+    : state(state), clock(clock), uavs(uavs), pool(threadCount), batchSize(batchSize),
+      scheduler(clock.getPacingPeriod()), controller(state, clock), requestsPending(false),
+      arena(nullptr), running(false),
+      snapshotsPublished(0), snapshotsAdopted(0), snapshotsSkipped(0), snapshotsTorn(0),
+      lastAdoptedVersion(0),
+      controlPhaseTotalMs(0.0), kinematicsPhaseTotalMs(0.0), collisionPhaseTotalMs(0.0),
+      publishPhaseTotalMs(0.0), contactResolveTotalMs(0.0), contactTotal(0)
+{
+    if (this->batchSize == 0)
+    {
+        this->batchSize = getDefaultBatchSize();
+    }
+
+    // Initial state so the renderer has positions and ids before the first tick
+    publishMembership();
+    publishSnapshot(0);
+}
+
+/*
+Keep one batch of the integrated arrays resident in L1 while a phase runs.
+Every per-UAV array starts on a cache line and the smallest elements are one
+byte, so whole multiples of kCacheLineBytes UAVs keep batches written by
+different threads on different lines.
+*/
+template <typename Integrator>
+size_t BasicSwarmStepper<Integrator>::getDefaultBatchSize()
+{
+    size_t items = kL1CacheBytes / kIntegratedBytesPerUav;
+    return std::max(kCacheLineBytes, items / kCacheLineBytes * kCacheLineBytes);
+}
+
+template <typename Integrator>
+BasicSwarmStepper<Integrator>::~BasicSwarmStepper()
+{
+    stop();
+}
+
+template <typename Integrator>
+void BasicSwarmStepper<Integrator>::start()
+{
+    if (!running)
+    {
+        running = true;
+        tickThread = std::thread(&BasicSwarmStepper::tickLoop, this);
+    }
+}
+
+template <typename Integrator>
+void BasicSwarmStepper<Integrator>::stop()
+{
+    if (running)
+    {
+        running = false;
+        if (tickThread.joinable())
+        {
+            tickThread.join();
+        }
+    }
+}
+
+/*
+Run one tick: control -> kinematics -> collisions -> publish, each phase a barrier
+*/
+template <typename Integrator>
+void BasicSwarmStepper<Integrator>::step()
+{
+    // Membership changes land between ticks, while no phase reads the fleet
+    applyMembershipChanges();
+
+    const size_t count = uavs.size();
+    const double deltaTime = clock.getTimeStep();
+
+    // Phase 1: control force for every UAV. The flight controller runs a
+    // shared pass (colour phase, orbit PIDs in one SoA pass), then one kernel
+    // per flight state over that state's bucket of ids.
+    auto phaseStart = std::chrono::steady_clock::now();
+    controller.run(pool, batchSize, deltaTime);
+    double controlMs = millisecondsSince(phaseStart);
+
+    // Phase 2: integrate the control force with the Integrator policy,
+    // streaming the SoA arrays per batch.
+    // Sleeping UAVs would not move, so only runs of consecutive awake ids are integrated.
+    phaseStart = std::chrono::steady_clock::now();
+    if (state.sleepingCount == 0)
+    {
+        pool.parallelFor(state.size(), batchSize, [&](size_t begin, size_t end)
+        {
+            Integrator::integrate(state, begin, end, deltaTime);
+        });
+    }
+    else
+    {
+        const std::vector<uint32_t>& awake = controller.getAwakeIds();
+        pool.parallelFor(awake.size(), batchSize, [&](size_t begin, size_t end)
+        {
+            size_t runBegin = begin;
+            while (runBegin < end)
+            {
+                size_t runEnd = runBegin + 1;
+                while (runEnd < end && awake[runEnd] == awake[runEnd - 1] + 1)
+                {
+                    ++runEnd;
+                }
+                Integrator::integrate(state, awake[runBegin], awake[runEnd - 1] + 1, deltaTime);
+                runBegin = runEnd;
+            }
+        });
+    }
+    double kinematicsMs = millisecondsSince(phaseStart);
+
+    // Phase 3: collision detection and response against the updated positions.
+    // The selected broadphase fills the shared pair list and the narrowphase
+    // gathers the pairs in contact, both in parallel; pairs of two sleeping
+    // UAVs are never candidates. The contacts are then
+    // coloured and resolved one colour at a time; contacts of a colour share
+    // no UAV, so each colour runs in parallel without locks and the outcome
+    // does not depend on the thread count.
+    phaseStart = std::chrono::steady_clock::now();
+    updateCollisionBroadphase(state);
+    pool.parallelFor(getCollisionPairCount(), batchSize, [&](size_t begin, size_t end)
+    {
+        findCollisionContacts(state, begin, end);
+    });
+
+    auto resolveStart = std::chrono::steady_clock::now();
+    colorCollisionContacts(count);
+    const ContactColoring& coloring = getContactColoring();
+    for (size_t color = 0; color < coloring.getColorCount(); ++color)
+    {
+        const size_t colorBegin = coloring.getColorBegin(color);
+        pool.parallelFor(coloring.getColorEnd(color) - colorBegin, batchSize, [&](size_t begin, size_t end)
+        {
+            resolveCollisionContacts(colorBegin + begin, colorBegin + end);
+        });
+    }
+    resolveCollisionContacts(coloring.getSerialBegin(), getCollisionContactCount());
+
+    // A contact moves both UAVs: sleeping ones rejoin and none sleeps next tick
+    controller.recordContacts(getCollisionContacts());
+    double contactMs = millisecondsSince(resolveStart);
+    double collisionMs = millisecondsSince(phaseStart);
+
+    // Phase 4: publish an immutable snapshot of this tick for the renderer
+    phaseStart = std::chrono::steady_clock::now();
+    // stats.ticks is only modified by this thread, so reading it needs no lock
+    publishSnapshot(stats.ticks + 1);
+    double publishMs = millisecondsSince(phaseStart);
+
+    // The next tick's control phase sees the advanced simulated time
+    clock.advance();
+
+    std::lock_guard<std::mutex> lock(statsMutex);
+    stats.ticks++;
+    controlPhaseTotalMs += controlMs;
+    kinematicsPhaseTotalMs += kinematicsMs;
+    collisionPhaseTotalMs += collisionMs;
+    contactResolveTotalMs += contactMs;
+    contactTotal += getCollisionContactCount();
+    stats.maxContactColors = std::max(stats.maxContactColors, coloring.getColorCount());
+    publishPhaseTotalMs += publishMs;
+}
+
+template <typename Integrator>
+void BasicSwarmStepper<Integrator>::requestLaunch(const Vec3& position)
+{
+    std::lock_guard<std::mutex> lock(requestMutex);
+    launchRequests.push_back(position);
+    requestsPending.store(true, std::memory_order_release);
+}
+
+template <typename Integrator>
+void BasicSwarmStepper<Integrator>::requestRetire(uint32_t id)
+{
+    std::lock_guard<std::mutex> lock(requestMutex);
+    retireRequests.push_back(id);
+    requestsPending.store(true, std::memory_order_release);
+}
+
+/*
+Retirements first, so a launch in the same tick can reuse the freed slot
+*/
+template <typename Integrator>
+void BasicSwarmStepper<Integrator>::applyMembershipChanges()
+{
+    if (!requestsPending.load(std::memory_order_acquire))
+    {
+        // Free versions whose readers have moved on since the last change
+        membership.reclaim();
+        return;
+    }
+
+    std::vector<Vec3> launches;
+    std::vector<uint32_t> retirements;
+    {
+        std::lock_guard<std::mutex> lock(requestMutex);
+        launches.swap(launchRequests);
+        retirements.swap(retireRequests);
+        requestsPending.store(false, std::memory_order_relaxed);
+    }
+
+    unsigned long long retiredNow = 0;
+    for (uint32_t id : retirements)
+    {
+        if (id < uavs.size() && !state.retired[id])
+        {
+            controller.retire(id);
+            freeIds.push_back(id);
+            retiredNow++;
+        }
+    }
+
+    unsigned long long launched = 0;
+    unsigned long long reused = 0;
+    unsigned long long dropped = 0;
+    for (const Vec3& position : launches)
+    {
+        if (!freeIds.empty())
+        {
+            const uint32_t id = freeIds.back();
+            freeIds.pop_back();
+            uavs[id]->relaunch(position);
+            controller.launch(id);
+            reused++;
+            launched++;
+        }
+        else if (ECE_UAV* uav = (arena != nullptr) ? arena->create(state, clock, position) : nullptr)
+        {
+            // The controller buckets the new id on its next run()
+            uavs.push_back(uav);
+            launched++;
+        }
+        else
+        {
+            dropped++;
+        }
+    }
+
+    if (retiredNow + launched > 0)
+    {
+        publishMembership();
+    }
+
+    std::lock_guard<std::mutex> lock(statsMutex);
+    stats.launched += launched;
+    stats.reusedSlots += reused;
+    stats.retired += retiredNow;
+    stats.launchesDropped += dropped;
+}
+
+template <typename Integrator>
+void BasicSwarmStepper<Integrator>::publishMembership()
+{
+    std::vector<uint32_t> ids;
+    ids.reserve(uavs.size() - state.retiredCount);
+    for (size_t id = 0; id < uavs.size(); ++id)
+    {
+        if (!state.retired[id])
+        {
+            ids.push_back(static_cast<uint32_t>(id));
+        }
+    }
+    membership.publish(std::move(ids));
+}
+
+template <typename Integrator>
+void BasicSwarmStepper<Integrator>::publishSnapshot(unsigned long long version)
+{
+    SwarmSnapshot& snapshot = snapshots.writeBuffer();
+    const size_t count = uavs.size();
+
+    snapshot.version = version;
+    snapshot.positions.resize(count);
+    snapshot.colorIntensity.resize(count);
+    snapshot.orbitCompleted.resize(count);
+
+    pool.parallelFor(count, batchSize, [&](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            snapshot.positions[i] = state.getPosition(i);
+            snapshot.colorIntensity[i] = static_cast<float>(uavs[i]->getColorIntensity());
+            snapshot.orbitCompleted[i] = uavs[i]->hasCompletedOrbit() ? 1 : 0;
+        }
+    });
+
+    snapshot.versionEnd = version;
+    snapshots.publish();
+    snapshotsPublished.fetch_add(1, std::memory_order_relaxed);
+}
+
+template <typename Integrator>
+const SwarmSnapshot& BasicSwarmStepper<Integrator>::acquireSnapshot()
+{
+    if (snapshots.update())
+    {
+        const SwarmSnapshot& snapshot = snapshots.readBuffer();
+        snapshotsAdopted.fetch_add(1, std::memory_order_relaxed);
+
+        if (snapshot.version != snapshot.versionEnd)
+        {
+            snapshotsTorn.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (snapshot.version > lastAdoptedVersion + 1)
+        {
+            snapshotsSkipped.fetch_add(snapshot.version - lastAdoptedVersion - 1, std::memory_order_relaxed);
+        }
+        lastAdoptedVersion = snapshot.version;
+    }
+    return snapshots.readBuffer();
+}
+
+template <typename Integrator>
+SnapshotStats BasicSwarmStepper<Integrator>::getSnapshotStats() const
+{
+    SnapshotStats result;
+    result.published = snapshotsPublished.load(std::memory_order_relaxed);
+    result.adopted = snapshotsAdopted.load(std::memory_order_relaxed);
+    result.skipped = snapshotsSkipped.load(std::memory_order_relaxed);
+    result.torn = snapshotsTorn.load(std::memory_order_relaxed);
+    return result;
+}
+
+template <typename Integrator>
+SwarmStepperStats BasicSwarmStepper<Integrator>::getStats() const
+{
+    std::lock_guard<std::mutex> lock(statsMutex);
+    SwarmStepperStats result = stats;
+    if (result.ticks > 0)
+    {
+        result.controlPhaseMs = controlPhaseTotalMs / result.ticks;
+        result.kinematicsPhaseMs = kinematicsPhaseTotalMs / result.ticks;
+        result.collisionPhaseMs = collisionPhaseTotalMs / result.ticks;
+        result.contactResolveMs = contactResolveTotalMs / result.ticks;
+        result.contactsPerTick = static_cast<double>(contactTotal) / result.ticks;
+        result.publishPhaseMs = publishPhaseTotalMs / result.ticks;
+    }
+    return result;
+}
+
+template <typename Integrator>
+void BasicSwarmStepper<Integrator>::run(unsigned long long tickCount)
+{
+    scheduler.start();
+    for (unsigned long long tick = 0; tick < tickCount; ++tick)
+    {
+        scheduler.waitForNextTick();
+        step();
+        scheduler.tickCompleted();
+    }
+}
+
+/*
+Tick loop: step while running, each tick released at its scheduler deadline
+*/
+template <typename Integrator>
+void BasicSwarmStepper<Integrator>::tickLoop()
+{
+    auto windowStart = std::chrono::steady_clock::now();
+    unsigned long long windowTicks = 0;
+
+    scheduler.start();
+    while (running)
+    {
+        // Real-time and time-warp modes sleep until the next tick is due
+        scheduler.waitForNextTick();
+        step();
+        scheduler.tickCompleted();
+        windowTicks++;
+
+        // Refresh the achieved tick rate once per second
+        double windowMs = millisecondsSince(windowStart);
+        if (windowMs >= 1000.0)
+        {
+            std::lock_guard<std::mutex> lock(statsMutex);
+            stats.ticksPerSecond = windowTicks * 1000.0 / windowMs;
+            windowStart = std::chrono::steady_clock::now();
+            windowTicks = 0;
+        }
+    }
+}
+
+template class BasicSwarmStepper<ConstantAccelerationIntegrator>;
+template class BasicSwarmStepper<SemiImplicitEulerIntegrator>;
+template class BasicSwarmStepper<VelocityVerletIntegrator>;
+template class BasicSwarmStepper<Rk4Integrator>;
@@ -0,0 +1,233 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Swarm stepper that advances every UAV on a fixed-size worker pool. Each tick
+runs the control, kinematics and collision passes as barrier-separated phases
+over cache-sized batches of UAVs, replacing the former thread-per-UAV design,
+and advances the shared SimClock by its fixed time step. A TickScheduler
+releases each tick at its absolute wall clock deadline.
+
+The kinematics update is the Integrator policy parameter (Integrators.h);
+SwarmStepper uses the original constant-acceleration update.
+
+UAVs can join and leave while the stepper runs. Any thread may queue a launch
+or a retirement; the stepper applies the queue at the start of the next tick,
+while no phase is running, and publishes the ids in service as a new
+SwarmMembership version that other threads read without locks. A launch
+reuses the slot of a retired UAV when there is one and only grows the fleet
+(in the UavArena given to setUavArena) otherwise.
+*/
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "AlignedAllocator.h"
+#include "ECE_UAV.h"
+#include "FlightController.h"
+#include "Integrators.h"
+#include "SimClock.h"
+#include "SwarmMembership.h"
+#include "SwarmState.h"
+#include "TickScheduler.h"
+#include "TripleBuffer.h"
+#include "UavArena.h"
+#include "Vec3.h"
+#include "WorkerPool.h"
+
+// Timing counters reported by the stepper
+struct SwarmStepperStats
+{
+    unsigned long long ticks = 0;  // Ticks completed since start
+    double ticksPerSecond = 0.0;   // Achieved tick rate over the last second
+    double controlPhaseMs = 0.0;   // Mean wall time of the control phase
+    double kinematicsPhaseMs = 0.0; // Mean wall time of the kinematics phase
+    double collisionPhaseMs = 0.0; // Mean wall time of the collision phase
+    double publishPhaseMs = 0.0;   // Mean wall time of snapshot publishing
+    double contactsPerTick = 0.0;  // Mean contacts resolved per tick
+    double contactResolveMs = 0.0; // Mean wall time to colour and resolve contacts (within the collision phase)
+    size_t maxContactColors = 0;   // Most colour batches needed in one tick
+    unsigned long long launched = 0;        // Launch requests applied (reused slots and new UAVs)
+    unsigned long long reusedSlots = 0;     // Launches that reused a retired UAV's slot
+    unsigned long long retired = 0;         // Retire requests applied
+    unsigned long long launchesDropped = 0; // Launches with no free slot and no arena room
+};
+
+// Immutable per-tick view of the swarm published for the render thread
+struct SwarmSnapshot
+{
+    unsigned long long version = 0;     // Tick that produced the snapshot (written first)
+    // Cache-line aligned so that batches filled by different threads never share a line
+    std::vector<Vec3, AlignedAllocator<Vec3>> positions;          // Indexed by UAV id
+    std::vector<float, AlignedAllocator<float>> colorIntensity;   // ECE6122 colour oscillation per UAV
+    std::vector<uint8_t, AlignedAllocator<uint8_t>> orbitCompleted; // 1 once the UAV finished its 60 s orbit
+    unsigned long long versionEnd = 0;  // Copy of version (written last)
+};
+
+// Reader-side snapshot counters
+struct SnapshotStats
+{
+    unsigned long long published = 0; // Snapshots published by physics
+    unsigned long long adopted = 0;    // Snapshots picked up by the reader
+    unsigned long long skipped = 0;    // Published but superseded before being read
+    unsigned long long torn = 0;       // Adopted with mismatching version markers
+};
+
+template <typename Integrator>
+class BasicSwarmStepper
+{
+    public:
+        /*
+        Constructor
+        Input:
+            - state: Kinematic store shared by the fleet (must outlive the stepper)
+            - clock: Simulated clock the fleet was created with, advanced once per tick
+            - uavs: Fleet to step, uavs[i] must have id i in state
+            - threadCount: Worker threads, 0 selects the hardware core count
+            - batchSize: UAVs per batch, 0 derives it from the L1 cache size
+              (a multiple of kCacheLineBytes, so batches never share a cache line)
+        uavs grows when launches need new UAVs, so only the stepper may change
+        it while the stepper exists.
+        */
+        BasicSwarmStepper(SwarmState& state, SimClock& clock, std::vector<ECE_UAV*>& uavs, size_t threadCount = 0, size_t batchSize = 0);
+        ~BasicSwarmStepper();
+
+        BasicSwarmStepper(const BasicSwarmStepper&) = delete;
+        BasicSwarmStepper& operator=(const BasicSwarmStepper&) = delete;
+
+        // Start the tick loop on its own thread, paced by the clock mode
+        void start();
+
+        // Stop and join the tick loop
+        void stop();
+
+        bool isRunning() const { return running; }
+
+        // Advance the whole swarm and the clock by one time step on the calling thread
+        void step();
+
+        /*
+        Run ticks on the calling thread, paced by the clock mode
+        Input: tickCount - number of ticks to run
+        */
+        void run(unsigned long long tickCount);
+
+        /*
+        Latest complete snapshot of the swarm, without taking any lock
+        Must only be called from a single reader thread (the renderer).
+        The reference stays valid until the next call.
+        */
+        const SwarmSnapshot& acquireSnapshot();
+
+        /*
+        Queue a new UAV at position, IDLE at rest (thread-safe)
+        Applied at the start of the next tick, in request order.
+        */
+        void requestLaunch(const Vec3& position);
+
+        /*
+        Queue the retirement of a UAV (thread-safe)
+        Input: id - UAV to retire; unknown or already retired ids are ignored
+        Applied at the start of the next tick, before the queued launches.
+        */
+        void requestRetire(uint32_t id);
+
+        // Arena that grows the fleet when a launch finds no retired slot to
+        // reuse (must outlive the stepper); without one such launches are dropped
+        void setUavArena(UavArena* uavArena) { arena = uavArena; }
+
+        // Ids in service, one version per membership change; register a reader
+        // slot per thread and read under a SwarmMembership::ReadGuard
+        SwarmMembership& getMembership() { return membership; }
+        const SwarmMembership& getMembership() const { return membership; }
+
+        // Snapshot publishing and reading counters (thread-safe)
+        SnapshotStats getSnapshotStats() const;
+
+        // Snapshot of the timing counters (thread-safe)
+        SwarmStepperStats getStats() const;
+
+        size_t getThreadCount() const { return pool.size(); }
+        size_t getBatchSize() const { return batchSize; }
+        static IntegratorType getIntegratorType() { return Integrator::type; }
+
+        // Batch size used when the constructor is given 0
+        static size_t getDefaultBatchSize();
+
+        // Tick pacing, overrun counters and latency histograms; configure before start()/run()
+        TickScheduler& getTickScheduler() { return scheduler; }
+        const TickScheduler& getTickScheduler() const { return scheduler; }
+
+        // State-bucketed control stage run in phase 1 (per-state timing counters)
+        FlightController& getFlightController() { return controller; }
+        const FlightController& getFlightController() const { return controller; }
+
+    private:
+        void tickLoop();
+
+        // Fill the back snapshot in parallel and publish it
+        void publishSnapshot(unsigned long long version);
+
+        // Apply the queued retirements and launches and publish the new membership
+        void applyMembershipChanges();
+
+        // Publish the ids that are not retired
+        void publishMembership();
+
+        SwarmState& state;
+        SimClock& clock;
+        std::vector<ECE_UAV*>& uavs;
+        WorkerPool pool;
+        size_t batchSize;
+
+        // Absolute-deadline pacing at the clock's wall time per tick
+        TickScheduler scheduler;
+
+        // Control phase: one kernel per flight state over that state's ids
+        FlightController controller;
+
+        // Membership queue filled by any thread, drained by the stepper
+        std::mutex requestMutex;
+        std::vector<Vec3> launchRequests;
+        std::vector<uint32_t> retireRequests;
+        std::atomic<bool> requestsPending;
+
+        // Stepper-owned: retired slots free for reuse (most recent last) and growth arena
+        std::vector<uint32_t> freeIds;
+        UavArena* arena;
+        SwarmMembership membership;
+
+        std::thread tickThread;
+        std::atomic<bool> running;
+
+        // Physics publishes one snapshot per tick, the renderer adopts the newest
+        TripleBuffer<SwarmSnapshot> snapshots;
+        std::atomic<unsigned long long> snapshotsPublished;
+
+        // Written by the reading thread on every adopt, so kept off the lines
+        // the physics thread writes
+        char readerPadding[kCacheLineBytes];
+        std::atomic<unsigned long long> snapshotsAdopted;
+        std::atomic<unsigned long long> snapshotsSkipped;
+        std::atomic<unsigned long long> snapshotsTorn;
+        unsigned long long lastAdoptedVersion;
+        char readerEndPadding[kCacheLineBytes];
+
+        // Timing accumulators, guarded by statsMutex
+        mutable std::mutex statsMutex;
+        SwarmStepperStats stats;
+        double controlPhaseTotalMs;
+        double kinematicsPhaseTotalMs;
+        double collisionPhaseTotalMs;
+        double publishPhaseTotalMs;
+        double contactResolveTotalMs;
+        unsigned long long contactTotal;
+};
+
+typedef BasicSwarmStepper<ConstantAccelerationIntegrator> SwarmStepper;
@@ -0,0 +1,155 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Implementation of the absolute-deadline tick scheduler.
+*/
+
+#include "TickScheduler.h"
+#include <cmath>
+#include <thread>
+
+namespace
+{
+    uint64_t toMicroseconds(std::chrono::steady_clock::duration duration)
+    {
+        long long microseconds = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+        return microseconds > 0 ? static_cast<uint64_t>(microseconds) : 0;
+    }
+}
+
+TickScheduler::TickScheduler(double periodSeconds, OverrunPolicy policy, unsigned int maxCatchUpTicks)
+    : period(periodSeconds), policy(policy), maxCatchUpTicks(maxCatchUpTicks),
+      deadline(Clock::now()), tickStart(deadline),
+      ticks(0), overruns(0), catchUpTicks(0), droppedTicks(0)
+{
+}
+
+void TickScheduler::setOverrunPolicy(OverrunPolicy newPolicy, unsigned int newMaxCatchUpTicks)
+{
+    policy = newPolicy;
+    maxCatchUpTicks = newMaxCatchUpTicks;
+}
+
+void TickScheduler::setPeriod(double periodSeconds)
+{
+    period = Seconds(periodSeconds);
+}
+
+void TickScheduler::start()
+{
+    deadline = Clock::now();
+}
+
+void TickScheduler::waitForNextTick()
+{
+    if (period.count() <= 0.0)
+    {
+        tickStart = Clock::now();
+        return;
+    }
+
+    std::this_thread::sleep_until(deadline);
+    tickStart = Clock::now();
+    startLatency.record(toMicroseconds(tickStart - deadline));
+}
+
+void TickScheduler::tickCompleted()
+{
+    const Clock::time_point tickEnd = Clock::now();
+    tickDuration.record(toMicroseconds(tickEnd - tickStart));
+    ticks.fetch_add(1, std::memory_order_relaxed);
+
+    if (period.count() <= 0.0)
+    {
+        return;
+    }
+
+    deadline += std::chrono::duration_cast<Clock::duration>(period);
+    if (tickEnd <= deadline)
+    {
+        return;
+    }
+
+    // The next tick is already late by lag periods
+    overruns.fetch_add(1, std::memory_order_relaxed);
+    const double lag = Seconds(tickEnd - deadline).count() / period.count();
+
+    unsigned long long skipped = 0;
+    if (policy == OverrunPolicy::DROP)
+    {
+        // Resume at the first deadline still in the future
+        skipped = static_cast<unsigned long long>(std::floor(lag)) + 1;
+    }
+    else
+    {
+        // Run the next tick immediately, but never fall more than maxCatchUpTicks behind
+        catchUpTicks.fetch_add(1, std::memory_order_relaxed);
+        if (lag > maxCatchUpTicks)
+        {
+            skipped = static_cast<unsigned long long>(std::ceil(lag - maxCatchUpTicks));
+        }
+    }
+
+    if (skipped > 0)
+    {
+        deadline += std::chrono::duration_cast<Clock::duration>(period * static_cast<double>(skipped));
+        droppedTicks.fetch_add(skipped, std::memory_order_relaxed);
+    }
+}
+
+TickSchedulerStats TickScheduler::getStats() const
+{
+    TickSchedulerStats stats;
+    stats.ticks = ticks.load(std::memory_order_relaxed);
+    stats.overruns = overruns.load(std::memory_order_relaxed);
+    stats.catchUpTicks = catchUpTicks.load(std::memory_order_relaxed);
+    stats.droppedTicks = droppedTicks.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void TickScheduler::printReport(FILE* out) const
+{
+    TickSchedulerStats stats = getStats();
+    if (period.count() > 0.0)
+    {
+        fprintf(out, "Tick scheduler: %.3f ms period, %s policy, %llu ticks, %llu overruns, %llu caught up, %llu dropped\n",
+                period.count() * 1000.0, getOverrunPolicyName(policy), stats.ticks, stats.overruns,
+                stats.catchUpTicks, stats.droppedTicks);
+        startLatency.print(out, "  start latency");
+    }
+    else
+    {
+        fprintf(out, "Tick scheduler: unpaced, %llu ticks\n", stats.ticks);
+    }
+    tickDuration.print(out, "  tick duration");
+}
+
+bool parseOverrunPolicy(const std::string& name, OverrunPolicy& policy)
+{
+    if (name == "catchup")
+    {
+        policy = OverrunPolicy::CATCH_UP;
+    }
+    else if (name == "drop")
+    {
+        policy = OverrunPolicy::DROP;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+const char* getOverrunPolicyName(OverrunPolicy policy)
+{
+    switch (policy)
+    {
+        case OverrunPolicy::CATCH_UP: return "catchup";
+        case OverrunPolicy::DROP:     return "drop";
+    }
+    return "unknown";
+}
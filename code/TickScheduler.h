@@ -0,0 +1,112 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Absolute-deadline pacing for the physics tick loop. Tick n is due at
+start + n * period and the loop sleeps with sleep_until, so compute time and
+sleep overshoot never accumulate into drift. When a tick finishes after the
+next deadline the loop has overrun, and the policy decides what happens:
+    - CATCH_UP: run the missed ticks back to back, at most maxCatchUpTicks
+      behind schedule; anything beyond that is dropped
+    - DROP: skip every missed deadline and continue with the next future one
+Each tick's start latency (wake-up time past its deadline) and compute time go
+into HDR-style histograms that can be queried live or printed at exit.
+*/
+
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include "LatencyHistogram.h"
+
+enum class OverrunPolicy
+{
+    CATCH_UP,
+    DROP
+};
+
+// Overrun counters (thread-safe snapshot)
+struct TickSchedulerStats
+{
+    unsigned long long ticks = 0;        // Ticks run
+    unsigned long long overruns = 0;     // Ticks that ended after the next deadline
+    unsigned long long catchUpTicks = 0; // Ticks run late to catch up
+    unsigned long long droppedTicks = 0; // Deadlines skipped without running a tick
+};
+
+class TickScheduler
+{
+    public:
+        /*
+        Constructor
+        Input:
+            - periodSeconds: Wall time per tick, 0 runs ticks back to back (no pacing)
+            - policy: Overrun handling
+            - maxCatchUpTicks: Most ticks CATCH_UP may fall behind before dropping
+        */
+        explicit TickScheduler(double periodSeconds = 0.01, OverrunPolicy policy = OverrunPolicy::CATCH_UP,
+                               unsigned int maxCatchUpTicks = 5);
+
+        TickScheduler(const TickScheduler&) = delete;
+        TickScheduler& operator=(const TickScheduler&) = delete;
+
+        // Change the policy; call while the tick loop is stopped
+        void setOverrunPolicy(OverrunPolicy policy, unsigned int maxCatchUpTicks);
+
+        // Change the pacing period; call while the tick loop is stopped
+        void setPeriod(double periodSeconds);
+
+        double getPeriod() const { return period.count(); }
+        OverrunPolicy getOverrunPolicy() const { return policy; }
+
+        // Anchor tick 0's deadline at the current time
+        void start();
+
+        // Sleep until the next tick is due (tick thread only)
+        void waitForNextTick();
+
+        // Account the tick that just ran and schedule the next deadline (tick thread only)
+        void tickCompleted();
+
+        // Wake-up lateness of every tick, microseconds
+        const LatencyHistogram& getStartLatency() const { return startLatency; }
+
+        // Compute time of every tick, microseconds
+        const LatencyHistogram& getTickDuration() const { return tickDuration; }
+
+        TickSchedulerStats getStats() const;
+
+        // Counters and both histograms
+        void printReport(FILE* out) const;
+
+    private:
+        using Clock = std::chrono::steady_clock;
+        using Seconds = std::chrono::duration<double>;
+
+        Seconds period;
+        OverrunPolicy policy;
+        unsigned int maxCatchUpTicks;
+
+        // Deadline of the tick about to run, and when it actually started
+        Clock::time_point deadline;
+        Clock::time_point tickStart;
+
+        LatencyHistogram startLatency;
+        LatencyHistogram tickDuration;
+
+        std::atomic<unsigned long long> ticks;
+        std::atomic<unsigned long long> overruns;
+        std::atomic<unsigned long long> catchUpTicks;
+        std::atomic<unsigned long long> droppedTicks;
+};
+
+/*
+Parse an overrun policy name (catchup, drop)
+Output: false if the name is unknown
+*/
+bool parseOverrunPolicy(const std::string& name, OverrunPolicy& policy);
+
+const char* getOverrunPolicyName(OverrunPolicy policy);
@@ -0,0 +1,48 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Implementation of the doubled-ring trail store.
+*/
+
+#include "TrailStore.h"
+#include <algorithm>
+
+TrailStore::TrailStore(size_t trailLength)
+    : trailLength(trailLength)
+{
+}
+
+void TrailStore::resize(size_t trailCount)
+{
+    vertices.resize(trailCount * 2 * trailLength);
+    runs.resize(trailCount, TrailRun{0, 0});
+}
+
+void TrailStore::push(size_t trail, const TrailPoint& point)
+{
+    TrailRun& run = runs[trail];
+    run.head = (run.head == 0) ? static_cast<uint32_t>(trailLength - 1) : run.head - 1;
+
+    TrailPoint* block = &vertices[trail * 2 * trailLength];
+    block[run.head] = point;
+    block[run.head + trailLength] = point;
+    if (run.count < trailLength)
+    {
+        run.count++;
+    }
+}
+
+/*
+Same arithmetic as StandardShading.vertexshader: the age is the distance from
+the head within the block, divided by the age of the oldest sample
+*/
+float TrailStore::getTextureCoordinate(size_t vertex) const
+{
+    const size_t blockSize = 2 * trailLength;
+    const TrailRun& run = runs[vertex / blockSize];
+    const float age = static_cast<float>(vertex % blockSize - run.head);
+    return age / static_cast<float>(std::max<uint32_t>(run.count, 2) - 1);
+}
@@ -0,0 +1,87 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Fixed-capacity light trails of every UAV in one contiguous vertex array, laid
+out so the renderer uploads a single buffer and draws all trails of a texture
+with one glMultiDrawArrays call. Kept free of OpenGL.
+
+Each trail owns 2 * trailLength consecutive vertices, a doubled ring: a new
+sample is written at the head slot and at head + trailLength, and the head
+moves back by one. The trail from newest to oldest sample is then always the
+contiguous run [head, head + count) of the trail's block, so adding a sample
+writes two vertices and moves nothing, and each trail is one line strip.
+
+Texture coordinates follow the age of a sample, as when every trail had its
+own buffer: the sample k places behind the newest gets u = k / (count - 1) and
+v = 0.5, so u runs from 0 at the newest to 1 at the oldest sample. They are not
+stored; the vertex shader computes them from gl_VertexID and the trail's
+TrailRun, and getTextureCoordinate does the same on the CPU.
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// One trail vertex as uploaded to the GPU
+struct TrailPoint
+{
+    float x, y, z;
+};
+
+// Newest slot and sample count of one trail, uploaded for the vertex shader
+struct TrailRun
+{
+    uint32_t head;  // Slot of the newest sample, in [0, trailLength)
+    uint32_t count; // Samples held, at most trailLength
+};
+
+class TrailStore
+{
+    public:
+        /*
+        Constructor
+        Input: trailLength - Samples kept per trail, the oldest are overwritten
+        */
+        explicit TrailStore(size_t trailLength);
+
+        /*
+        Set the number of trails; new trails start empty
+        The vertex and run arrays move, so re-upload both after a change.
+        */
+        void resize(size_t trailCount);
+
+        // Add the newest sample of a trail
+        void push(size_t trail, const TrailPoint& point);
+
+        // Drop every sample of a trail
+        void clear(size_t trail) { runs[trail].count = 0; }
+
+        // Newest-to-oldest run of a trail in getVertices(), as glMultiDrawArrays first/count
+        size_t getFirst(size_t trail) const { return trail * 2 * trailLength + runs[trail].head; }
+        size_t getCount(size_t trail) const { return runs[trail].count; }
+
+        size_t getTrailCount() const { return runs.size(); }
+        size_t getTrailLength() const { return trailLength; }
+
+        // Vertices of all trails, 2 * trailLength per trail
+        const std::vector<TrailPoint>& getVertices() const { return vertices; }
+
+        // Head and count of every trail, in trail order
+        const std::vector<TrailRun>& getRuns() const { return runs; }
+
+        /*
+        Texture u of a vertex, as the vertex shader computes it
+        Input: vertex - Index into getVertices() inside its trail's run
+        Output: 0 at the newest sample of the trail, 1 at the oldest
+        */
+        float getTextureCoordinate(size_t vertex) const;
+
+    private:
+        size_t trailLength;
+        std::vector<TrailPoint> vertices;
+        std::vector<TrailRun> runs;
+};
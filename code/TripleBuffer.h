@@ -0,0 +1,77 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Lock-free single-producer / single-consumer triple buffer. The writer fills a
+private back buffer and publishes it with one atomic exchange; the reader
+swaps in the newest published buffer with another exchange. Neither side ever
+waits for the other and the reader always sees a complete buffer. The three
+buffers and the writer- and reader-owned indices sit on separate cache lines,
+so filling one buffer never invalidates lines the other side is reading.
+*/
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include "AlignedAllocator.h"
+
+template <typename T>
+class TripleBuffer
+{
+    public:
+        TripleBuffer() : middle(1), back(0), front(2) {}
+
+        TripleBuffer(const TripleBuffer&) = delete;
+        TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+        // Writer: buffer to fill before the next publish()
+        T& writeBuffer() { return buffers[back].value; }
+
+        // Writer: make the filled buffer the newest published one
+        void publish()
+        {
+            uint8_t previous = middle.exchange(static_cast<uint8_t>(back | kFreshBit), std::memory_order_acq_rel);
+            back = previous & kIndexMask;
+        }
+
+        /*
+        Reader: adopt the newest published buffer if there is one
+        Output: true when readBuffer() changed
+        */
+        bool update()
+        {
+            if ((middle.load(std::memory_order_acquire) & kFreshBit) == 0)
+            {
+                return false;
+            }
+            uint8_t previous = middle.exchange(front, std::memory_order_acq_rel);
+            front = previous & kIndexMask;
+            return true;
+        }
+
+        // Reader: most recently adopted buffer
+        const T& readBuffer() const { return buffers[front].value; }
+
+    private:
+        static const uint8_t kIndexMask = 0x3;
+        static const uint8_t kFreshBit = 0x4;
+
+        // A buffer padded so that no two buffers share a cache line
+        struct Slot
+        {
+            T value;
+            char padding[kCacheLineBytes];
+        };
+
+        Slot buffers[3];
+
+        // Index of the shared middle buffer plus a "not yet read" flag
+        std::atomic<uint8_t> middle;
+
+        // Owned by the writer and the reader respectively
+        uint8_t back;
+        char backPadding[kCacheLineBytes];
+        uint8_t front;
+};
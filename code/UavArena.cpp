@@ -0,0 +1,38 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Implementation of the contiguous UAV arena.
+*/
+
+#include "UavArena.h"
+#include <new>
+#include "AlignedAllocator.h"
+
+UavArena::UavArena(size_t capacity)
+    : slots(AlignedAllocator<ECE_UAV>().allocate(capacity)), count(0), capacity(capacity)
+{
+}
+
+UavArena::~UavArena()
+{
+    // Reverse construction order, like a container of the same objects
+    while (count > 0)
+    {
+        slots[--count].~ECE_UAV();
+    }
+    AlignedAllocator<ECE_UAV>().deallocate(slots, capacity);
+}
+
+ECE_UAV* UavArena::create(SwarmState& swarmState, const SimClock& simClock, const Vec3& position)
+{
+    if (count == capacity)
+    {
+        return nullptr;
+    }
+    ECE_UAV* uav = new (slots + count) ECE_UAV(swarmState, simClock, position);
+    count++;
+    return uav;
+}
@@ -0,0 +1,48 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Contiguous, cache-line-aligned storage for the fleet's ECE_UAV handles. All
+UAVs are constructed in place in one block allocated up front, so walking the
+fleet touches consecutive lines instead of scattered heap chunks, and the
+64-byte alignment of ECE_UAV (which keeps its mutex on its own line) is
+honoured, which C++14 operator new does not guarantee for over-aligned types.
+Objects never move; pointers stay valid until the arena is destroyed.
+*/
+
+#pragma once
+#include <cstddef>
+#include "ECE_UAV.h"
+
+class UavArena
+{
+    public:
+        /*
+        Constructor
+        Input: capacity - Most UAVs the arena can hold
+        */
+        explicit UavArena(size_t capacity);
+
+        // Destroys every UAV created in the arena
+        ~UavArena();
+
+        UavArena(const UavArena&) = delete;
+        UavArena& operator=(const UavArena&) = delete;
+
+        /*
+        Construct a UAV in the next free slot
+        Input: Same as the ECE_UAV constructor
+        Output: The new UAV, or nullptr if the arena is full
+        */
+        ECE_UAV* create(SwarmState& swarmState, const SimClock& simClock, const Vec3& position);
+
+        size_t size() const { return count; }
+        size_t getCapacity() const { return capacity; }
+
+    private:
+        ECE_UAV* slots;
+        size_t count;
+        size_t capacity;
+};
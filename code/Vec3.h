@@ -1,35 +1,48 @@
 /*
 Author: Matt Chung
 Class: ECE6122
-Last Date Modified: November 29, 2025
+Last Date Modified: October 16, 2026
 
 Description:
-Simple 3D vector class for basic vector operations.
+Simple 3D vector class for basic vector operations, templated on the scalar
+type. Vec3 (double) is used throughout; Vec3f is the float instantiation used
+when the physics core is built or compared in single precision.
 */
 
 #pragma once
 #include <cmath>
 
 
-class Vec3 
+template <typename T>
+class BasicVec3 
 {
     public:
-        double x, y, z;
+        typedef T Scalar;
+
+        T x, y, z;
         
-        Vec3(double x = 0, double y = 0, double z = 0) : x(x), y(y), z(z) {}
+        BasicVec3(T x = 0, T y = 0, T z = 0) : x(x), y(y), z(z) {}
+
+        // Conversion between precisions, component by component
+        template <typename U>
+        BasicVec3(const BasicVec3<U>& v) : x(static_cast<T>(v.x)), y(static_cast<T>(v.y)), z(static_cast<T>(v.z)) {}
         
-        Vec3 operator+(const Vec3& v) const { return Vec3(x + v.x, y + v.y, z + v.z); }
-        Vec3 operator-(const Vec3& v) const { return Vec3(x - v.x, y - v.y, z - v.z); }
-        Vec3 operator*(double s) const { return Vec3(x * s, y * s, z * s); }
-        Vec3 operator/(double s) const { return Vec3(x / s, y / s, z / s); }
-        Vec3& operator+=(const Vec3& v) { x += v.x; y += v.y; z += v.z; return *this; }
+        BasicVec3 operator+(const BasicVec3& v) const { return BasicVec3(x + v.x, y + v.y, z + v.z); }
+        BasicVec3 operator-(const BasicVec3& v) const { return BasicVec3(x - v.x, y - v.y, z - v.z); }
+        BasicVec3 operator*(T s) const { return BasicVec3(x * s, y * s, z * s); }
+        BasicVec3 operator/(T s) const { return BasicVec3(x / s, y / s, z / s); }
+        BasicVec3& operator+=(const BasicVec3& v) { x += v.x; y += v.y; z += v.z; return *this; }
         
-        double magnitude() const { return sqrt(x*x + y*y + z*z); }
-        double distance(const Vec3& v) const { return (*this - v).magnitude(); }
-        Vec3 normalized() const 
+        T dot(const BasicVec3& v) const { return x * v.x + y * v.y + z * v.z; }
+        T magnitude() const { return std::sqrt(x*x + y*y + z*z); }
+        T distance(const BasicVec3& v) const { return (*this - v).magnitude(); }
+        BasicVec3 normalized() const 
         { 
-            double mag = magnitude();
+            T mag = magnitude();
             if (mag > 0) return *this / mag;
-            return Vec3(0, 0, 0);
+            return BasicVec3(0, 0, 0);
         }
-};
\ No newline at end of file
+};
+
+typedef BasicVec3<double> Vec3;
+typedef BasicVec3<float> Vec3f;
@@ -0,0 +1,151 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Implementation of the packed mesh vertex conversions.
+*/
+
+#include "VertexPacking.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+    // Largest magnitude of a signed 10-bit normalized component
+    const float kNormalScale = 511.0f;
+
+    // Vertices addressable by 16-bit indices
+    const size_t kShortIndexVertices = 65536;
+
+    uint32_t packNormalComponent(float value)
+    {
+        const float clamped = std::max(-1.0f, std::min(1.0f, value));
+        const int32_t component = static_cast<int32_t>(std::lround(clamped * kNormalScale));
+        return static_cast<uint32_t>(component) & 0x3ffu;
+    }
+
+    float unpackNormalComponent(uint32_t bits)
+    {
+        // Sign-extend the 10-bit field
+        const int32_t component = static_cast<int32_t>(bits << 22) >> 22;
+        return std::max(-1.0f, static_cast<float>(component) / kNormalScale);
+    }
+}
+
+uint16_t packHalf(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const uint32_t sign = (bits >> 16) & 0x8000u;
+    const uint32_t magnitude = bits & 0x7fffffffu;
+
+    if (magnitude > 0x7f800000u)
+    {
+        return static_cast<uint16_t>(sign | 0x7e00u); // NaN
+    }
+    if (magnitude >= 0x47800000u)
+    {
+        return static_cast<uint16_t>(sign | 0x7c00u); // 65536 and above, or infinity
+    }
+    if (magnitude < 0x33000000u)
+    {
+        return static_cast<uint16_t>(sign); // Below half the smallest subnormal
+    }
+
+    uint32_t half;
+    uint32_t remainder;
+    uint32_t halfway;
+    if (magnitude < 0x38800000u)
+    {
+        // Subnormal half: the implicit bit joins the mantissa, shifted by the exponent deficit
+        const uint32_t mantissa = (magnitude & 0x7fffffu) | 0x800000u;
+        const uint32_t shift = 126u - (magnitude >> 23);
+        half = mantissa >> shift;
+        remainder = mantissa & ((1u << shift) - 1u);
+        halfway = 1u << (shift - 1u);
+    }
+    else
+    {
+        // Rebias the exponent from 127 to 15; a rounding carry may reach infinity, as it should
+        half = (((magnitude >> 23) - 112u) << 10) | ((magnitude & 0x7fffffu) >> 13);
+        remainder = magnitude & 0x1fffu;
+        halfway = 0x1000u;
+    }
+    if (remainder > halfway || (remainder == halfway && (half & 1u)))
+    {
+        half++;
+    }
+    return static_cast<uint16_t>(sign | half);
+}
+
+float unpackHalf(uint16_t bits)
+{
+    const uint32_t sign = static_cast<uint32_t>(bits & 0x8000u) << 16;
+    const uint32_t exponent = (bits >> 10) & 0x1fu;
+    const uint32_t mantissa = bits & 0x3ffu;
+
+    if (exponent == 0)
+    {
+        const float magnitude = std::ldexp(static_cast<float>(mantissa), -24);
+        return sign ? -magnitude : magnitude;
+    }
+    const uint32_t result = (exponent == 31)
+        ? sign | 0x7f800000u | (mantissa << 13)
+        : sign | ((exponent + 112u) << 23) | (mantissa << 13);
+    float value;
+    std::memcpy(&value, &result, sizeof(value));
+    return value;
+}
+
+uint32_t packNormal(float x, float y, float z)
+{
+    return packNormalComponent(x) | (packNormalComponent(y) << 10) | (packNormalComponent(z) << 20);
+}
+
+void unpackNormal(uint32_t bits, float& x, float& y, float& z)
+{
+    x = unpackNormalComponent(bits & 0x3ffu);
+    y = unpackNormalComponent((bits >> 10) & 0x3ffu);
+    z = unpackNormalComponent((bits >> 20) & 0x3ffu);
+}
+
+std::vector<MeshVertex> packVertices(const float* positions, const float* uvs, const float* normals,
+                                       size_t vertexCount)
+{
+    std::vector<MeshVertex> vertices(vertexCount);
+    const uint16_t centre = packHalf(0.5f);
+    const uint32_t up = packNormal(0.0f, 0.0f, 1.0f);
+    for (size_t i = 0; i < vertexCount; ++i)
+    {
+        MeshVertex& vertex = vertices[i];
+        std::copy(positions + 3 * i, positions + 3 * i + 3, vertex.position);
+        vertex.uv[0] = uvs ? packHalf(uvs[2 * i]) : centre;
+        vertex.uv[1] = uvs ? packHalf(uvs[2 * i + 1]) : centre;
+        vertex.normal = normals ? packNormal(normals[3 * i], normals[3 * i + 1], normals[3 * i + 2]) : up;
+    }
+    return vertices;
+}
+
+size_t getIndexSize(size_t vertexCount)
+{
+    return vertexCount <= kShortIndexVertices ? sizeof(uint16_t) : sizeof(uint32_t);
+}
+
+std::vector<uint8_t> packIndices(const std::vector<uint32_t>& indices, size_t vertexCount)
+{
+    std::vector<uint8_t> bytes(indices.size() * getIndexSize(vertexCount));
+    if (getIndexSize(vertexCount) == sizeof(uint32_t))
+    {
+        std::memcpy(bytes.data(), indices.data(), bytes.size());
+        return bytes;
+    }
+    for (size_t i = 0; i < indices.size(); ++i)
+    {
+        const uint16_t index = static_cast<uint16_t>(indices[i]);
+        std::memcpy(&bytes[i * sizeof(uint16_t)], &index, sizeof(uint16_t));
+    }
+    return bytes;
+}
@@ -0,0 +1,63 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Interleaved, tightly packed mesh vertex used by every static mesh the renderer
+draws. Kept free of OpenGL so the packing can be checked without a GPU
+(uav_checks verify-vertex-packing).
+
+A vertex is 20 bytes instead of the 32 of separate float position, UV and
+normal buffers:
+    position  3 x float                      (attribute 0, GL_FLOAT)
+    uv        2 x IEEE half float            (attribute 1, GL_HALF_FLOAT)
+    normal    signed normalized 10:10:10:2   (attribute 2, GL_INT_2_10_10_10_REV)
+
+Indices come from indexVBO as 32-bit values and are narrowed to 16 bits for
+upload whenever the mesh has at most 65536 vertices.
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct MeshVertex
+{
+    float position[3];
+    uint16_t uv[2];
+    uint32_t normal;
+};
+
+// Float to IEEE 754 half, rounded to nearest even; out-of-range values become infinity
+uint16_t packHalf(float value);
+float unpackHalf(uint16_t bits);
+
+// Unit normal to signed normalized 10:10:10:2 with x in the low bits and w = 0
+uint32_t packNormal(float x, float y, float z);
+void unpackNormal(uint32_t bits, float& x, float& y, float& z);
+
+/*
+Interleave separate position, UV and normal arrays
+Input:
+    - positions: 3 floats per vertex
+    - uvs: 2 floats per vertex, or nullptr for (0.5, 0.5) everywhere
+    - normals: 3 floats per vertex, or nullptr for +Z everywhere
+    - vertexCount: Number of vertices
+Output: One MeshVertex per vertex
+*/
+std::vector<MeshVertex> packVertices(const float* positions, const float* uvs, const float* normals,
+                                       size_t vertexCount);
+
+// Bytes per index of a mesh: 2 when every vertex is addressable in 16 bits, 4 otherwise
+size_t getIndexSize(size_t vertexCount);
+
+/*
+Element buffer contents for a mesh
+Input:
+    - indices: Triangle indices, each below vertexCount
+    - vertexCount: Number of vertices of the mesh
+Output: The indices stored in getIndexSize(vertexCount) bytes each, native byte order
+*/
+std::vector<uint8_t> packIndices(const std::vector<uint32_t>& indices, size_t vertexCount);
@@ -0,0 +1,128 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Implementation of the fixed-size worker pool used by the swarm stepper.
+*/
+
+#include "WorkerPool.h"
+#include <algorithm>
+
+/*
+Constructor: spawn threadCount - 1 workers (the caller is the last thread)
+*/
+WorkerPool::WorkerPool(size_t threadCount)
+    : job(nullptr), jobCount(0), jobBatchSize(1), nextItem(0),
+      generation(0), busyWorkers(0), shuttingDown(false)
+{
+    if (threadCount == 0)
+    {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    workers.reserve(threadCount - 1);
+    for (size_t i = 1; i < threadCount; ++i)
+    {
+        workers.emplace_back(&WorkerPool::workerLoop, this);
+    }
+}
+
+/*
+Destructor: wake all workers and join them
+*/
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        shuttingDown = true;
+    }
+    wakeCondition.notify_all();
+
+    for (std::thread& worker : workers)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+}
+
+/*
+Split [0, count) into batches and run them on all threads
+*/
+void WorkerPool::parallelFor(size_t count, size_t batchSize, const BatchFunction& fn)
+{
+    if (count == 0)
+    {
+        return;
+    }
+    batchSize = std::max<size_t>(batchSize, 1);
+
+    // Small jobs are not worth waking the workers for
+    if (workers.empty() || count <= batchSize)
+    {
+        fn(0, count);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        job = &fn;
+        jobCount = count;
+        jobBatchSize = batchSize;
+        nextItem.store(0);
+        busyWorkers = workers.size();
+        ++generation;
+    }
+    wakeCondition.notify_all();
+
+    // The calling thread works on the job as well
+    runBatches();
+
+    // Barrier: wait for every worker to finish its last batch
+    std::unique_lock<std::mutex> lock(poolMutex);
+    doneCondition.wait(lock, [this] { return busyWorkers == 0; });
+    job = nullptr;
+}
+
+void WorkerPool::runBatches()
+{
+    while (true)
+    {
+        size_t begin = nextItem.fetch_add(jobBatchSize);
+        if (begin >= jobCount)
+        {
+            break;
+        }
+        size_t end = std::min(begin + jobBatchSize, jobCount);
+        (*job)(begin, end);
+    }
+}
+
+void WorkerPool::workerLoop()
+{
+    unsigned long long seenGeneration = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(poolMutex);
+            wakeCondition.wait(lock, [&] { return shuttingDown || generation != seenGeneration; });
+            if (shuttingDown)
+            {
+                return;
+            }
+            seenGeneration = generation;
+        }
+
+        runBatches();
+
+        {
+            std::lock_guard<std::mutex> lock(poolMutex);
+            --busyWorkers;
+        }
+        doneCondition.notify_one();
+    }
+}
@@ -0,0 +1,81 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Fixed-size worker pool used by the swarm stepper. Work is submitted as a
+range of items that is split into batches; each call to parallelFor acts as a
+barrier, so consecutive calls form strictly ordered simulation phases.
+*/
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "AlignedAllocator.h"
+
+class WorkerPool
+{
+    public:
+        // Batch callback: processes items in [begin, end)
+        using BatchFunction = std::function<void(size_t begin, size_t end)>;
+
+        /*
+        Constructor
+        Input:
+            - threadCount: Total number of threads taking part in parallelFor,
+              including the calling thread. 0 selects the hardware core count.
+        */
+        explicit WorkerPool(size_t threadCount = 0);
+        ~WorkerPool();
+
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        /*
+        Run fn over [0, count) in batches of batchSize items
+        Input:
+            - count: Number of items
+            - batchSize: Items per batch (0 is treated as 1)
+            - fn: Batch callback, invoked concurrently from several threads
+        Returns once every batch has completed (barrier semantics).
+        */
+        void parallelFor(size_t count, size_t batchSize, const BatchFunction& fn);
+
+        // Number of threads that execute batches (workers + caller)
+        size_t size() const { return workers.size() + 1; }
+
+    private:
+        void workerLoop();
+
+        // Claim and run batches of the current job until none are left
+        void runBatches();
+
+        std::vector<std::thread> workers;
+
+        std::mutex poolMutex;
+        std::condition_variable wakeCondition;
+        std::condition_variable doneCondition;
+
+        // Current job description (valid while a parallelFor is in flight)
+        // Current job, read by every thread for each batch
+        const BatchFunction* job;
+        size_t jobCount;
+        size_t jobBatchSize;
+
+        // Next unclaimed item, advanced by every thread for each batch. It sits
+        // on a cache line of its own so claims do not invalidate the job fields.
+        char jobPadding[kCacheLineBytes];
+        std::atomic<size_t> nextItem;
+        char nextItemPadding[kCacheLineBytes - sizeof(std::atomic<size_t>)];
+
+        // Incremented for every job so sleeping workers can detect new work
+        unsigned long long generation;
+        size_t busyWorkers;
+        bool shuttingDown;
+};
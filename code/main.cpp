@@ -1,7 +1,7 @@
 /*
 Authors: Aaron Huang, Dulani Wijayarathne, Matt Chung
 Class: ECE 6122
-Last Date Modified: November 30th, 2025
+Last Date Modified: October 16, 2026
 Description: Final Project
 
 Project Statement of work:
@@ -23,6 +23,9 @@ we compromised by adding more complexity to the default final project and submit
 #include <iostream>
 #include <limits>
 #include <algorithm>
+#include <string>
+#include <random>
+#include <cstddef>
 
 // Include GLEW
 #include <GL/glew.h>
@@ -43,8 +46,17 @@ using namespace glm;
 #include <common/vboindexer.hpp>
 #include <vector>
 #include "ECE_UAV.h"
+#include "EventLog.h"
+#include "InstancePacker.h"
+#include "Mesh.h"
+#include "TrailStore.h"
+#include "VertexPacking.h"
 #include "Vec3.h"
 #include "PhysicsGlobals.h"
+#include "SimClock.h"
+#include "SwarmMembership.h"
+#include "SwarmStepper.h"
+#include "UavArena.h"
 
 // Adding function for window resize
 void framebuffer_size_callback(GLFWwindow* window, int width, int height)
@@ -57,8 +69,57 @@ void framebuffer_size_callback(GLFWwindow* window, int width, int height)
 }
 
 
-int main( void )
+int main( int argc, char* argv[] )
 {
+	// Optional command line: --broadphase=brute|grid|dbvt|sweep --time-warp=N --seed=N --event-log=FILE --overrun=catchup|drop
+	double timeWarp = 1.0;
+	OverrunPolicy overrunPolicy = OverrunPolicy::CATCH_UP;
+	uint64_t seed = std::random_device()();
+	for (int arg = 1; arg < argc; ++arg) {
+		const std::string option = argv[arg];
+		const std::string prefix = "--broadphase=";
+		const std::string warpPrefix = "--time-warp=";
+		const std::string seedPrefix = "--seed=";
+		const std::string logPrefix = "--event-log=";
+		const std::string overrunPrefix = "--overrun=";
+		BroadphaseType broadphaseType;
+		if (option.compare(0, prefix.size(), prefix) == 0 &&
+			parseBroadphaseType(option.substr(prefix.size()), broadphaseType)) {
+			setBroadphaseType(broadphaseType);
+		}
+		else if (option.compare(0, warpPrefix.size(), warpPrefix) == 0 &&
+			atof(option.c_str() + warpPrefix.size()) > 0.0) {
+			timeWarp = atof(option.c_str() + warpPrefix.size());
+		}
+		else if (option.compare(0, seedPrefix.size(), seedPrefix) == 0) {
+			seed = strtoull(option.c_str() + seedPrefix.size(), nullptr, 10);
+		}
+		else if (option.compare(0, logPrefix.size(), logPrefix) == 0) {
+			// State transitions, collisions and diagnostics go to a binary log (see uav_log_decode)
+			if (!openEventLog(option.substr(logPrefix.size()))) {
+				fprintf(stderr, "Cannot create event log %s\n", option.c_str() + logPrefix.size());
+				return -1;
+			}
+		}
+		else if (option.compare(0, overrunPrefix.size(), overrunPrefix) == 0 &&
+			parseOverrunPolicy(option.substr(overrunPrefix.size()), overrunPolicy)) {
+			// Physics ticks that miss their deadline are caught up (default) or dropped
+		}
+		else {
+			fprintf(stderr, "Unknown option %s (expected --broadphase=brute|grid|dbvt|sweep, --time-warp=N, --seed=N, --event-log=FILE or --overrun=catchup|drop)\n", argv[arg]);
+			return -1;
+		}
+	}
+	printf("Collision broadphase: %s\n", getBroadphaseTypeName(getBroadphaseType()));
+
+	// Orbit paths are reproducible: rerun with the printed seed to get the same flight
+	setRandomSeed(seed);
+	printf("Random seed: %llu\n", static_cast<unsigned long long>(seed));
+
+	// 100 Hz simulated clock, played back in real time unless warped
+	SimClock simClock(0.01, timeWarp == 1.0 ? SimClockMode::REAL_TIME : SimClockMode::TIME_WARP, timeWarp);
+	printf("Simulation clock: %s x%.1f\n", getSimClockModeName(simClock.getMode()), simClock.getWarpFactor());
+
 	// Initialize GLFW
 	if( !glfwInit() )
 	{
@@ -119,10 +180,6 @@ int main( void )
 	// Cull triangles which normal is not towards the camera
 	//glEnable(GL_CULL_FACE);
 
-	GLuint VertexArrayID;
-	glGenVertexArrays(1, &VertexArrayID);
-	glBindVertexArray(VertexArrayID);
-
 	// Create and compile our GLSL program from the shaders
 	GLuint programID = LoadShaders(
 		"assets/shaders/StandardShading.vertexshader",
@@ -133,6 +190,11 @@ int main( void )
 	GLuint MatrixID = glGetUniformLocation(programID, "MVP");
 	GLuint ViewMatrixID = glGetUniformLocation(programID, "V");
 	GLuint ModelMatrixID = glGetUniformLocation(programID, "M");
+	GLuint ProjectionMatrixID = glGetUniformLocation(programID, "P");
+	GLint uUseInstancing = glGetUniformLocation(programID, "useInstancing");
+	GLint uUseTrailAge = glGetUniformLocation(programID, "useTrailAge");
+	GLint uTrailBlockSize = glGetUniformLocation(programID, "trailBlockSize");
+	GLint uTrailRuns = glGetUniformLocation(programID, "trailRuns");
 
 	// Get handles for solid color (green floor)
 	GLint uUseSolid   = glGetUniformLocation(programID, "useSolidColor");
@@ -195,18 +257,16 @@ int main( void )
 	// Bind our default texture in Texture Unit 0 (unimportant; we'll bind per-model later)
 	glUseProgram(programID);
 	glUniform1i(TextureID, 0);
+	// Trail runs live in unit 1 so the buffer sampler never shares a unit with the 2D one
+	glUniform1i(uTrailRuns, 1);
 	glUniform1f(uColorIntensityID, 1.0f);
 
 
 
 
-	// Generic model resources container
+	// Generic model resources container: one interleaved mesh with its own VAO
 	struct ModelResources {
-		GLuint vbo = 0;
-		GLuint uvbo = 0;
-		GLuint nbo = 0;
-		GLuint ebo = 0;
-		std::vector<unsigned short> idx;
+		Mesh mesh;
 		float scale = 1.0f;
 	};
 
@@ -214,7 +274,7 @@ int main( void )
 						  std::vector<glm::vec3>& outVerts,
 						  std::vector<glm::vec2>& outUVs,
 						  std::vector<glm::vec3>& outNormals,
-						  std::vector<unsigned short>& outIdx,
+						  std::vector<unsigned int>& outIdx,
 						  std::vector<glm::vec3>& outIndexedVerts) -> bool {
 		std::vector<glm::vec3> v;
 		std::vector<glm::vec2> u;
@@ -232,7 +292,7 @@ int main( void )
 	std::vector<glm::vec3> uav1Verts, uav1IndexedVerts; // first 5
 	std::vector<glm::vec2> uav1UVs;
 	std::vector<glm::vec3> uav1Normals;
-	std::vector<unsigned short> uav1Idx;
+	std::vector<unsigned int> uav1Idx;
 	if (!loadIndexed("assets/models/suzanne.obj", uav1Verts, uav1UVs, uav1Normals, uav1Idx, uav1IndexedVerts)) {
 		return -1;
 	}
@@ -240,7 +300,7 @@ int main( void )
 	std::vector<glm::vec3> uav2Verts, uav2IndexedVerts; // next 5
 	std::vector<glm::vec2> uav2UVs;
 	std::vector<glm::vec3> uav2Normals;
-	std::vector<unsigned short> uav2Idx;
+	std::vector<unsigned int> uav2Idx;
 	if (!loadIndexed("assets/models/cube.obj", uav2Verts, uav2UVs, uav2Normals, uav2Idx, uav2IndexedVerts)) {
 		return -1;
 	}
@@ -248,7 +308,7 @@ int main( void )
 	std::vector<glm::vec3> uav3Verts, uav3IndexedVerts; // last 5
 	std::vector<glm::vec2> uav3UVs;
 	std::vector<glm::vec3> uav3Normals;
-	std::vector<unsigned short> uav3Idx;
+	std::vector<unsigned int> uav3Idx;
 	if (!loadIndexed("assets/models/chicken_01.obj", uav3Verts, uav3UVs, uav3Normals, uav3Idx, uav3IndexedVerts)) {
 		return -1;
 	}
@@ -266,27 +326,13 @@ int main( void )
 	// Build buffers for three UAV model groups
 	ModelResources models[3];
 
+	// Interleave positions, half-float UVs and packed normals into one buffer behind one VAO
 	auto uploadBuffers = [](ModelResources& mr,
 							const std::vector<glm::vec3>& verts,
 							const std::vector<glm::vec2>& uvs,
 							const std::vector<glm::vec3>& norms,
-							const std::vector<unsigned short>& idx) {
-		glGenBuffers(1, &mr.vbo);
-		glBindBuffer(GL_ARRAY_BUFFER, mr.vbo);
-		glBufferData(GL_ARRAY_BUFFER, verts.size() * sizeof(glm::vec3), &verts[0], GL_STATIC_DRAW);
-
-		glGenBuffers(1, &mr.uvbo);
-		glBindBuffer(GL_ARRAY_BUFFER, mr.uvbo);
-		glBufferData(GL_ARRAY_BUFFER, uvs.size() * sizeof(glm::vec2), &uvs[0], GL_STATIC_DRAW);
-
-		glGenBuffers(1, &mr.nbo);
-		glBindBuffer(GL_ARRAY_BUFFER, mr.nbo);
-		glBufferData(GL_ARRAY_BUFFER, norms.size() * sizeof(glm::vec3), &norms[0], GL_STATIC_DRAW);
-
-		glGenBuffers(1, &mr.ebo);
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mr.ebo);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx.size() * sizeof(unsigned short), &idx[0], GL_STATIC_DRAW);
-		mr.idx = idx;
+							const std::vector<unsigned int>& idx) {
+		mr.mesh.upload(packVertices(&verts[0].x, &uvs[0].x, &norms[0].x, verts.size()), idx);
 	};
 
 	uploadBuffers(models[0], uav1IndexedVerts, uav1UVs, uav1Normals, uav1Idx);
@@ -318,6 +364,19 @@ int main( void )
 	models[1].scale = computeScale(uav2IndexedVerts);
 	models[2].scale = computeScale(uav3IndexedVerts);
 
+	// Per-UAV model matrices and colour intensities, packed once per frame into
+	// one instance buffer and drawn with one instanced call per model group
+	InstancePacker instancePacker;
+	for (size_t group = 0; group < kModelGroupCount; ++group) {
+		instancePacker.setGroupScale(group, models[group].scale);
+	}
+	// One instance buffer per group, its attributes recorded in the group's VAO
+	GLuint instanceBuffers[kModelGroupCount];
+	glGenBuffers(kModelGroupCount, instanceBuffers);
+	for (size_t group = 0; group < kModelGroupCount; ++group) {
+		models[group].mesh.attachInstances(instanceBuffers[group]);
+	}
+
 	// Get a handle for our "LightPosition" uniform
 	glUseProgram(programID);
 	GLuint LightID = glGetUniformLocation(programID, "LightPosition_worldspace");
@@ -330,18 +389,39 @@ int main( void )
 	double lastPollTime = glfwGetTime();
 	const double pollInterval = 0.030; // 30 milliseconds
 
-	// For vector initialization - 15 UAVs for multithreading
+	// For vector initialization - 15 UAVs stepped by the worker pool
 	const int numberUAVs = 15;
-	std::vector<glm::mat4> modelMatrices(numberUAVs);
-	std::vector<glm::mat4> MVPMatrices(numberUAVs);
+	const int maxUAVs = 2 * numberUAVs; // Room for reinforcements launched with N
 
-	// Trail colors initialization
+	// Trail colors initialization - every trail lives in one ring buffer store
 	const int TRAIL_LENGTH = 100;
-	std::vector<std::vector<glm::vec3>> uavTrails(numberUAVs);
+	TrailStore trails(TRAIL_LENGTH);
+	trails.resize(numberUAVs);
 	GLuint trailVBO;
 	glGenBuffers(1, &trailVBO);
+	// Head and count of every trail, read by the vertex shader to give each sample its age as u
+	GLuint trailRunBuffer;
+	glGenBuffers(1, &trailRunBuffer);
+	GLuint trailRunTexture;
+	glGenTextures(1, &trailRunTexture);
+	// Positions only; the shader derives UVs and normals come from the constant attribute set before drawing
+	GLuint trailVAO;
+	glGenVertexArrays(1, &trailVAO);
+	glBindVertexArray(trailVAO);
+	glEnableVertexAttribArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, trailVBO);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(TrailPoint), (void*)0);
+	glBindVertexArray(0);
+	size_t trailBufferTrails = 0; // Trails the GPU buffers are sized for
+	bool trailsDirty = false;	  // New samples not uploaded yet
+	std::array<std::vector<GLint>, kModelGroupCount> trailFirsts;
+	std::array<std::vector<GLsizei>, kModelGroupCount> trailCounts;
 
 	// Create 15 ECE_UAV objects placed on football yard lines using a 3x5 grid
+	// Kinematic state for the whole fleet lives in one structure-of-arrays store
+	SwarmState swarmState(numberUAVs);
+	// The UAV handles are constructed in place in one cache-line-aligned block
+	UavArena uavArena(maxUAVs);
 	std::vector<ECE_UAV*> uavs;
 	GLOBAL_UAV_LIST = &uavs;
 
@@ -372,21 +452,27 @@ int main( void )
 	}
 
 	for (int i = 0; i < numberUAVs; ++i) {
-		uavs.push_back(new ECE_UAV(formationPositions[i]));
+		uavs.push_back(uavArena.create(swarmState, simClock, formationPositions[i]));
 	}
 
-	// Start all UAV threads
-	for (int i = 0; i < numberUAVs; ++i) {
-		uavs[i]->start();
-	}
+	// Step the whole swarm on a worker pool sized to the core count
+	SwarmStepper stepper(swarmState, simClock, uavs);
+	stepper.getTickScheduler().setOverrunPolicy(overrunPolicy, 5);
+	stepper.setUavArena(&uavArena);
+	stepper.start();
 
-	// Position storage for UAVs (used in render loop)
-	std::vector<Vec3> currentPos(numberUAVs);
+	// Latest physics snapshot (used in render loop); read without any UAV lock
+	const SwarmSnapshot* snapshot = &stepper.acquireSnapshot();
 
-	// --- ADD THIS TO FIX INVISIBILITY ON FRAME 1 ---
-    for (int i = 0; i < numberUAVs; ++i) {
-        currentPos[i] = uavs[i]->getPosition(); 
-    }
+	// UAVs in service, read from the stepper's membership without locks; ids
+	// launched after the adopted snapshot are skipped until it catches up
+	const size_t membershipReader = stepper.getMembership().registerReader();
+	std::vector<uint32_t> drawIds;
+	{
+		SwarmMembership::ReadGuard members(stepper.getMembership(), membershipReader);
+		drawIds = members.ids();
+	}
+	size_t launches = 0;
 
 	// For Rotation and Translation
 	static float rotationAngle = 360.0f / (float)numberUAVs;
@@ -413,16 +499,9 @@ int main( void )
 		1.f,0.f,  0.f,1.f,  1.f,1.f,
 	};
 
-	// Load floor into VBOs
-	GLuint floorVBO;
-	glGenBuffers(1, &floorVBO);
-	glBindBuffer(GL_ARRAY_BUFFER, floorVBO);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(floorVerts), floorVerts, GL_STATIC_DRAW);
-
-	GLuint floorUV_VBO;
-	glGenBuffers(1, &floorUV_VBO);
-	glBindBuffer(GL_ARRAY_BUFFER, floorUV_VBO);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(floorUVs), floorUVs, GL_STATIC_DRAW);
+	// Load floor into its mesh, normals constant up (+Z) for both tris
+	Mesh floorMesh;
+	floorMesh.upload(packVertices(floorVerts, floorUVs, nullptr, 6), std::vector<unsigned int>());
 
 	// Create sphere geometry for target visualization
 	const float sphereRadius = 10.0f;
@@ -430,7 +509,7 @@ int main( void )
 	const int sphereSlices = 20;
 	std::vector<glm::vec3> sphereVertices;
 	std::vector<glm::vec3> sphereNormals;
-	std::vector<unsigned short> sphereIndices;
+	std::vector<unsigned int> sphereIndices;
 
 	// Generate sphere vertices
 	for (int i = 0; i <= sphereStacks; ++i) {
@@ -466,27 +545,19 @@ int main( void )
 		}
 	}
 
-	// Load sphere into VBOs
-	GLuint sphereVertexBuffer;
-	glGenBuffers(1, &sphereVertexBuffer);
-	glBindBuffer(GL_ARRAY_BUFFER, sphereVertexBuffer);
-	glBufferData(GL_ARRAY_BUFFER, sphereVertices.size() * sizeof(glm::vec3), &sphereVertices[0], GL_STATIC_DRAW);
-
-	GLuint sphereNormalBuffer;
-	glGenBuffers(1, &sphereNormalBuffer);
-	glBindBuffer(GL_ARRAY_BUFFER, sphereNormalBuffer);
-	glBufferData(GL_ARRAY_BUFFER, sphereNormals.size() * sizeof(glm::vec3), &sphereNormals[0], GL_STATIC_DRAW);
-
-	GLuint sphereIndexBuffer;
-	glGenBuffers(1, &sphereIndexBuffer);
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, sphereIndexBuffer);
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sphereIndices.size() * sizeof(unsigned short), &sphereIndices[0], GL_STATIC_DRAW);
+	// Load sphere into its mesh, UVs constant at the texture centre
+	Mesh sphereMesh;
+	sphereMesh.upload(packVertices(&sphereVertices[0].x, nullptr, &sphereNormals[0].x, sphereVertices.size()), sphereIndices);
 
 	// Enable toggling of direct light
 	GLint uEnableDirectLoc = glGetUniformLocation(programID, "uEnableDirect");
 	bool enableDirect = true;
 	int lastL = GLFW_RELEASE;
 
+	// N launches a reinforcement from the next formation spot, R retires the oldest UAV in service
+	int lastN = GLFW_RELEASE;
+	int lastR = GLFW_RELEASE;
+
 	bool simulationRunning = true;
 	do{
 		// Update light toggle
@@ -496,6 +567,17 @@ int main( void )
 		}
 		lastL = L;
 
+		int N = glfwGetKey(window, GLFW_KEY_N);
+		if (N == GLFW_PRESS && lastN == GLFW_RELEASE) {
+			stepper.requestLaunch(formationPositions[launches++ % formationPositions.size()]);
+		}
+		lastN = N;
+		int R = glfwGetKey(window, GLFW_KEY_R);
+		if (R == GLFW_PRESS && lastR == GLFW_RELEASE && !drawIds.empty()) {
+			stepper.requestRetire(drawIds.front());
+		}
+		lastR = R;
+
 		glUseProgram(programID);
 		glUniform1i(uEnableDirectLoc, enableDirect ? 1 : 0);
 
@@ -511,22 +593,41 @@ int main( void )
 
 		// Poll UAV positions every 30ms
 		if (currentTime - lastPollTime >= pollInterval) {
-			// Update positions from UAV threads and check completion state
-			bool allFinished = true;
-			for (int i = 0; i < numberUAVs; ++i) {
-				Vec3 p = uavs[i]->getPosition();
-				currentPos[i] = p; // Store position for light trails and rendering
-
-				// For trail storage
-				glm::vec3 glPos(p.x, p.y, p.z);
-				uavTrails[i].insert(uavTrails[i].begin(), glPos);
-
-				// Remove old trail points exceeding TRAIL_LENGTH
-				if (uavTrails[i].size() > TRAIL_LENGTH) {
-                    uavTrails[i].pop_back();
-                }
-
-				if (!uavs[i]->hasCompletedOrbit())
+			// Adopt the newest published physics snapshot and check completion state
+			snapshot = &stepper.acquireSnapshot(); // Positions for light trails and rendering
+			const size_t snapshotCount = snapshot->positions.size();
+			if (snapshotCount > trails.getTrailCount()) {
+				trails.resize(snapshotCount);
+			}
+
+			// Walk the current membership; retired UAVs lose their trails
+			std::vector<uint8_t> inService(snapshotCount, 0);
+			{
+				SwarmMembership::ReadGuard members(stepper.getMembership(), membershipReader);
+				drawIds.clear();
+				for (uint32_t id : members.ids()) {
+					if (id < snapshotCount) {
+						drawIds.push_back(id);
+						inService[id] = 1;
+					}
+				}
+			}
+			for (size_t i = 0; i < snapshotCount; ++i) {
+				if (!inService[i]) {
+					trails.clear(i);
+				}
+			}
+
+			trailsDirty = true;
+
+			bool allFinished = !drawIds.empty();
+			for (uint32_t i : drawIds) {
+				const Vec3& p = snapshot->positions[i];
+
+				// For trail storage - overwrites the oldest point once TRAIL_LENGTH are held
+				trails.push(i, TrailPoint{ (float)p.x, (float)p.y, (float)p.z });
+
+				if (!snapshot->orbitCompleted[i])
 				{
 					allFinished = false;
 				}
@@ -578,24 +679,7 @@ int main( void )
 		glUniform1f(uColorIntensityID, 1.0f);
 
 		// draw:
-		glEnableVertexAttribArray(0);
-		glBindBuffer(GL_ARRAY_BUFFER, floorVBO);
-		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
-
-		glEnableVertexAttribArray(1);
-		glBindBuffer(GL_ARRAY_BUFFER, floorUV_VBO);
-		glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
-
-		// Make UVs constant (no array), e.g., sample center of texture
-		// This was for green floor with solid color
-		// glDisableVertexAttribArray(1);
-		// glVertexAttrib2f(1, 0.5f, 0.5f);
-
-		// Make normals constant up (+Z) for both tris
-		glDisableVertexAttribArray(2);
-		glVertexAttrib3f(2, 0.0f, 0.0f, 1.0f);
-
-		glDrawArrays(GL_TRIANGLES, 0, 6);
+		floorMesh.draw(GL_TRIANGLES);
 
 		/////// End of Green Floor ////////
 
@@ -613,59 +697,31 @@ int main( void )
 
 		// We'll bind textures per-model inside the draw loop (group-dependent)
 
-		// Precompute orientation and scale so each UAV stands upright and matches physics bounds
-		const glm::mat4 uavOrientation = glm::rotate(glm::mat4(1.0f), glm::radians(90.0f), glm::vec3(1.0f, 0.0f, 0.0f));
-
 		// Z-axis spin angle based on time
 		float spinAngle = glm::radians(fmod(currentTime * 360.0, 360.0)); // 50 degrees per second
 
-		// For loop to draw the UAVs (first 5 replaced by UAV2: suzanne)
-		for (int object = 0; object < numberUAVs; ++object)
-		{
-			// Get current position from UAV thread
-			double x, y, z;
-
-			x = currentPos[object].x;
-			y = currentPos[object].y;
-			z = currentPos[object].z;
-			
-			// Select which model group this UAV belongs to: 0 (0-4), 1 (5-9), 2 (10-14)
-			int group = (object < 5) ? 0 : (object < 10) ? 1 : 2;
-			const ModelResources& mr = models[group];
-
-			// define model matrix and parameters
-			modelMatrices[object] = glm::mat4(1.0);
-			float colorIntensity = static_cast<float>(uavs[object]->getColorIntensity());
-			glUniform1f(uColorIntensityLoc, colorIntensity);
-			// Translate to UAV position, then orient upright, spin around Z-axis, and scale down with per-model scale
-			modelMatrices[object] = glm::translate(modelMatrices[object], glm::vec3((float)x, (float)y, (float)z));
-			modelMatrices[object] = modelMatrices[object] * uavOrientation;
-			modelMatrices[object] = glm::rotate(modelMatrices[object], spinAngle, glm::vec3(0.0f, 1.0f, 0.0f));
-			modelMatrices[object] = glm::scale(modelMatrices[object], glm::vec3(mr.scale));
-
-			// Update MVP matrix
-			MVPMatrices[object] = ProjectionMatrix * ViewMatrix * modelMatrices[object];
+		// Upright, spinning, scaled model matrix and colour intensity of every UAV in service
+		instancePacker.pack(*snapshot, drawIds, spinAngle);
 
-			glUniformMatrix4fv(MatrixID, 1, GL_FALSE, &MVPMatrices[object][0][0]);
-			glUniformMatrix4fv(ModelMatrixID, 1, GL_FALSE, &modelMatrices[object][0][0]);
-
-			// 1rst attribute buffer : vertices
-			glEnableVertexAttribArray(0);
-			glBindBuffer(GL_ARRAY_BUFFER, mr.vbo);
-			glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
-
-			// 2nd attribute buffer : UVs
-			glEnableVertexAttribArray(1);
-			glBindBuffer(GL_ARRAY_BUFFER, mr.uvbo);
-			glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
+		// Orphan and refill each group's instance buffer once for the frame
+		for (size_t group = 0; group < kModelGroupCount; ++group) {
+			const size_t groupBytes = instancePacker.getGroupCount(group) * sizeof(UavInstance);
+			if (groupBytes == 0) continue;
+			glBindBuffer(GL_ARRAY_BUFFER, instanceBuffers[group]);
+			glBufferData(GL_ARRAY_BUFFER, groupBytes, nullptr, GL_STREAM_DRAW);
+			glBufferSubData(GL_ARRAY_BUFFER, 0, groupBytes, instancePacker.getInstances() + instancePacker.getGroupBegin(group));
+		}
 
-			// 3rd attribute buffer : normals
-			glEnableVertexAttribArray(2);
-			glBindBuffer(GL_ARRAY_BUFFER, mr.nbo);
-			glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
+		glUniform1i(uUseInstancing, GL_TRUE);
+		glUniformMatrix4fv(ProjectionMatrixID, 1, GL_FALSE, &ProjectionMatrix[0][0]);
+		glUniform1f(uColorIntensityLoc, 1.0f); // The per-instance intensity applies instead
 
-			// Index buffer
-			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mr.ebo);
+		// One instanced draw per model group (first 5 UAVs: suzanne, next 5: cube, rest: chicken)
+		for (size_t group = 0; group < kModelGroupCount; ++group)
+		{
+			const size_t instanceCount = instancePacker.getGroupCount(group);
+			if (instanceCount == 0) continue;
+			const ModelResources& mr = models[group];
 
 			// Bind texture for this model group
 			GLuint boundTex = (group == 0) ? texture0 : (group == 1) ? texture1 : texture2;
@@ -673,10 +729,13 @@ int main( void )
 			glBindTexture(GL_TEXTURE_2D, boundTex);
 			glUniform1i(TextureID, 0);
 
-			// Draw the triangles !
-			glDrawElements(GL_TRIANGLES, mr.idx.size(), GL_UNSIGNED_SHORT, (void*)0);
+			// Draw every UAV of the group at once
+			mr.mesh.drawInstanced((GLsizei)instanceCount);
 		}
 
+		// Back to per-draw uniforms for the trails, sphere and floor
+		glUniform1i(uUseInstancing, GL_FALSE);
+
 		/////// END OF NEW MATRIX //////////
 
 
@@ -700,59 +759,63 @@ int main( void )
 		glUniform1i(uUseSolid, GL_FALSE);
         glUniform1f(uColorIntensityLoc, 1.0f);
 
-		// Make normals constant up
-		glDisableVertexAttribArray(2);
+		// Make normals constant up (the trail VAO has no normal array)
         glVertexAttrib3f(2, 0.0f, 0.0f, 1.0f);
 
-		// Create line segments for each trail
-		for(int i=0; i<numberUAVs; i++) 
-		{
-            if(uavTrails[i].size() < 2) continue; // Need 2 points to make a line
+		// Size the trail buffers to the store
+		if (trailBufferTrails != trails.getTrailCount()) {
+			trailBufferTrails = trails.getTrailCount();
+			glBindBuffer(GL_ARRAY_BUFFER, trailVBO);
+			glBufferData(GL_ARRAY_BUFFER, trails.getVertices().size() * sizeof(TrailPoint), NULL, GL_DYNAMIC_DRAW);
+			glBindBuffer(GL_TEXTURE_BUFFER, trailRunBuffer);
+			glBufferData(GL_TEXTURE_BUFFER, trails.getRuns().size() * sizeof(TrailRun), NULL, GL_DYNAMIC_DRAW);
+			glBindTexture(GL_TEXTURE_BUFFER, trailRunTexture);
+			glTexBuffer(GL_TEXTURE_BUFFER, GL_RG32UI, trailRunBuffer);
+			trailsDirty = true;
+		}
+
+		// Upload the whole store once per poll rather than once per trail per frame
+		if (trailsDirty) {
+			glBindBuffer(GL_ARRAY_BUFFER, trailVBO);
+			glBufferSubData(GL_ARRAY_BUFFER, 0, trails.getVertices().size() * sizeof(TrailPoint), trails.getVertices().data());
+			glBindBuffer(GL_TEXTURE_BUFFER, trailRunBuffer);
+			glBufferSubData(GL_TEXTURE_BUFFER, 0, trails.getRuns().size() * sizeof(TrailRun), trails.getRuns().data());
+			trailsDirty = false;
+		}
 
-			// Determine which texture to use based on UAV group
-            int group = (i < 5) ? 0 : (i < 10) ? 1 : 2;
-            GLuint boundTex = (group == 0) ? texture0 : (group == 1) ? texture1 : texture2;
+		// One line strip per trail, gathered by texture group
+		for (size_t group = 0; group < kModelGroupCount; ++group) {
+			trailFirsts[group].clear();
+			trailCounts[group].clear();
+		}
+		for (uint32_t i : drawIds)
+		{
+			if (trails.getCount(i) < 2) continue; // Need 2 points to make a line
 
-			// Bind those textures
-			glActiveTexture(GL_TEXTURE0);
-            glBindTexture(GL_TEXTURE_2D, boundTex);
-            glUniform1i(TextureID, 0);
+			const size_t group = InstancePacker::getModelGroup(i);
+			trailFirsts[group].push_back((GLint)trails.getFirst(i));
+			trailCounts[group].push_back((GLsizei)trails.getCount(i));
+		}
 
-			// Create vectors for line segments
-			std::vector<glm::vec3> trailVerts;
-            std::vector<glm::vec2> trailUVs;
+		glBindVertexArray(trailVAO);
+		glActiveTexture(GL_TEXTURE1);
+		glBindTexture(GL_TEXTURE_BUFFER, trailRunTexture);
+		glUniform1i(uUseTrailAge, GL_TRUE);
+		glUniform1i(uTrailBlockSize, (GLint)(2 * trails.getTrailLength()));
 
-			// Populate trail positions and UV vectors
-			for (size_t k = 0; k < uavTrails[i].size(); k++) 
-			{
-				// Position
-				trailVerts.push_back(uavTrails[i][k]);
+		// Draw all trails sharing a texture with one call
+		for (size_t group = 0; group < kModelGroupCount; ++group)
+		{
+			if (trailFirsts[group].empty()) continue;
 
-				// Generate UVs
-				float u = (float)k / (float)(uavTrails[i].size() - 1);
-                trailUVs.push_back(glm::vec2(u, 0.5f));
-			}
+			GLuint boundTex = (group == 0) ? texture0 : (group == 1) ? texture1 : texture2;
+			glActiveTexture(GL_TEXTURE0);
+			glBindTexture(GL_TEXTURE_2D, boundTex);
+			glUniform1i(TextureID, 0);
 
-			// Generate vertices
-			glEnableVertexAttribArray(0);
-            glBindBuffer(GL_ARRAY_BUFFER, trailVBO);
-            glBufferData(GL_ARRAY_BUFFER, trailVerts.size() * sizeof(glm::vec3), &trailVerts[0], GL_DYNAMIC_DRAW);
-            glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
-
-			// Generate UVs
-			GLuint trailUVBuffer; 
-            glGenBuffers(1, &trailUVBuffer);
-            glEnableVertexAttribArray(1);
-            glBindBuffer(GL_ARRAY_BUFFER, trailUVBuffer);
-            glBufferData(GL_ARRAY_BUFFER, trailUVs.size() * sizeof(glm::vec2), &trailUVs[0], GL_DYNAMIC_DRAW);
-            glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
-
-			// Draw line strip
-			glDrawArrays(GL_LINE_STRIP, 0, trailVerts.size());
-			
-			// Clean up temporary UV buffer
-			glDeleteBuffers(1, &trailUVBuffer);
-        }
+			glMultiDrawArrays(GL_LINE_STRIP, trailFirsts[group].data(), trailCounts[group].data(), (GLsizei)trailFirsts[group].size());
+		}
+		glUniform1i(uUseTrailAge, GL_FALSE);
 
 		/////// END OF LIGHT TRAILS //////////
 
@@ -774,19 +837,7 @@ int main( void )
 		glUniform1f(uColorIntensityID, 1.0f);
 
 		// Draw sphere
-		glEnableVertexAttribArray(0);
-		glBindBuffer(GL_ARRAY_BUFFER, sphereVertexBuffer);
-		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
-
-		glDisableVertexAttribArray(1);
-		glVertexAttrib2f(1, 0.5f, 0.5f);
-
-		glEnableVertexAttribArray(2);
-		glBindBuffer(GL_ARRAY_BUFFER, sphereNormalBuffer);
-		glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
-
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, sphereIndexBuffer);
-		glDrawElements(GL_TRIANGLES, sphereIndices.size(), GL_UNSIGNED_SHORT, (void*)0);
+		sphereMesh.draw(GL_TRIANGLES);
 
 		// Reset alpha to opaque for other objects
 		glUniform1f(uSolidAlpha, 1.0f);
@@ -794,10 +845,8 @@ int main( void )
 		/////// End of Target Sphere ////////
 
 
-		// Disable vertex arrays
-		glDisableVertexAttribArray(0);
-		glDisableVertexAttribArray(1);
-		glDisableVertexAttribArray(2);
+		// Unbind the last vertex array
+		glBindVertexArray(0);
 		glUniform1f(uColorIntensityID, 1.0f);
 
 		// Swap buffers
@@ -809,35 +858,47 @@ int main( void )
 		  glfwGetKey(window, GLFW_KEY_ESCAPE ) != GLFW_PRESS &&
 		  glfwWindowShouldClose(window) == 0 );
 
-	// Stop all UAV threads
-	for (int i = 0; i < numberUAVs; ++i) {
-		uavs[i]->stop();
+	// Stop the swarm stepper and report its throughput
+	stepper.getMembership().unregisterReader(membershipReader);
+	stepper.stop();
+	SwarmStepperStats stepperStats = stepper.getStats();
+	printf("Swarm stepper: %llu ticks, %.1f ticks/s, phases (ms/tick) control %.3f, kinematics %.3f, collision %.3f, publish %.3f\n",
+		stepperStats.ticks, stepperStats.ticksPerSecond,
+		stepperStats.controlPhaseMs, stepperStats.kinematicsPhaseMs, stepperStats.collisionPhaseMs,
+		stepperStats.publishPhaseMs);
+	printf("Contacts: %.2f per tick in up to %zu colours, %.3f ms/tick colouring and resolving\n",
+		stepperStats.contactsPerTick, stepperStats.maxContactColors, stepperStats.contactResolveMs);
+	SnapshotStats snapshotStats = stepper.getSnapshotStats();
+	printf("Snapshots: %llu published, %llu rendered, %llu skipped, %llu torn\n",
+		snapshotStats.published, snapshotStats.adopted, snapshotStats.skipped, snapshotStats.torn);
+	stepper.getFlightController().printReport(stdout);
+	stepper.getTickScheduler().printReport(stdout);
+	if (isEventLogOpen()) {
+		closeEventLog();
+		EventLogStats logStats = getEventLogStats();
+		printf("Event log: %llu records written, %llu sampled out, %llu dropped\n",
+			logStats.written, logStats.sampledOut, logStats.dropped);
 	}
-	// Delete the memory 
-    for (int i = 0; i < numberUAVs; ++i) {
-        delete uavs[i];
-    }
+
+	// The arena destroys the UAVs when main returns
 	uavs.clear();
 
 	// Cleanup VBO and shader
 	// Cleanup buffers for all model groups
-	glDeleteBuffers(1, &models[0].vbo);
-	glDeleteBuffers(1, &models[0].uvbo);
-	glDeleteBuffers(1, &models[0].nbo);
-	glDeleteBuffers(1, &models[0].ebo);
-	glDeleteBuffers(1, &models[1].vbo);
-	glDeleteBuffers(1, &models[1].uvbo);
-	glDeleteBuffers(1, &models[1].nbo);
-	glDeleteBuffers(1, &models[1].ebo);
-	glDeleteBuffers(1, &models[2].vbo);
-	glDeleteBuffers(1, &models[2].uvbo);
-	glDeleteBuffers(1, &models[2].nbo);
-	glDeleteBuffers(1, &models[2].ebo);
+	models[0].mesh.release();
+	models[1].mesh.release();
+	models[2].mesh.release();
+	floorMesh.release();
+	sphereMesh.release();
+	glDeleteBuffers(kModelGroupCount, instanceBuffers);
+	glDeleteBuffers(1, &trailVBO);
+	glDeleteBuffers(1, &trailRunBuffer);
+	glDeleteTextures(1, &trailRunTexture);
+	glDeleteVertexArrays(1, &trailVAO);
 	glDeleteProgram(programID);
 	glDeleteTextures(1, &texture0);
 	glDeleteTextures(1, &texture1);
 	glDeleteTextures(1, &texture2);
-	glDeleteVertexArrays(1, &VertexArrayID);
 
 	// Close OpenGL window and terminate GLFW
 	glfwTerminate();
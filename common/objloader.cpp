@@ -84,33 +84,42 @@ bool loadOBJ(
 			fscanf(file, "%f %f %f\n", &normal.x, &normal.y, &normal.z );
 			temp_normals.push_back(normal);
 		}else if ( strcmp( lineHeader, "f" ) == 0 ){
-			std::string vertex1, vertex2, vertex3;
-			int vertexIndexRaw[3], uvIndexRaw[3], normalIndexRaw[3];
-			unsigned int vertexIndex[3], uvIndex[3], normalIndex[3];
-			int matches = fscanf(file, "%d/%d/%d %d/%d/%d %d/%d/%d\n", &vertexIndexRaw[0], &uvIndexRaw[0], &normalIndexRaw[0], &vertexIndexRaw[1], &uvIndexRaw[1], &normalIndexRaw[1], &vertexIndexRaw[2], &uvIndexRaw[2], &normalIndexRaw[2] );
-			if (matches != 9){
-				printf("File can't be read by our simple parser :-( Try exporting with other options\n");
-				fclose(file);
-				return false;
+			// Faces may have more than 3 corners (quads, polygons): read the whole line, whatever its length, then split it into a fan
+			std::string faceLine;
+			int c;
+			while ((c = fgetc(file)) != EOF && c != '\n'){
+				faceLine.push_back(static_cast<char>(c));
 			}
-			for(int k = 0; k < 3; ++k){
-				if(!normalizeIndex(vertexIndexRaw[k], temp_vertices.size(), vertexIndex[k]) ||
-				   !normalizeIndex(uvIndexRaw[k], temp_uvs.size(), uvIndex[k]) ||
-				   !normalizeIndex(normalIndexRaw[k], temp_normals.size(), normalIndex[k])){
+			std::vector<unsigned int> faceVertex, faceUV, faceNormal;
+			const char * cursor = faceLine.c_str();
+			int vertexIndexRaw, uvIndexRaw, normalIndexRaw, consumed;
+			while (sscanf(cursor, "%d/%d/%d%n", &vertexIndexRaw, &uvIndexRaw, &normalIndexRaw, &consumed) == 3){
+				unsigned int vertexIndex, uvIndex, normalIndex;
+				if(!normalizeIndex(vertexIndexRaw, temp_vertices.size(), vertexIndex) ||
+				   !normalizeIndex(uvIndexRaw, temp_uvs.size(), uvIndex) ||
+				   !normalizeIndex(normalIndexRaw, temp_normals.size(), normalIndex)){
 					printf("OBJ face references invalid index (possibly due to negative indices).\n");
 					fclose(file);
 					return false;
 				}
+				faceVertex.push_back(vertexIndex);
+				faceUV    .push_back(uvIndex);
+				faceNormal.push_back(normalIndex);
+				cursor += consumed;
+			}
+			if (faceVertex.size() < 3){
+				printf("File can't be read by our simple parser :-( Try exporting with other options\n");
+				fclose(file);
+				return false;
+			}
+			for(size_t k = 1; k + 1 < faceVertex.size(); ++k){
+				const size_t corners[3] = { 0, k, k + 1 };
+				for(size_t corner : corners){
+					vertexIndices.push_back(faceVertex[corner]);
+					uvIndices    .push_back(faceUV[corner]);
+					normalIndices.push_back(faceNormal[corner]);
+				}
 			}
-			vertexIndices.push_back(vertexIndex[0]);
-			vertexIndices.push_back(vertexIndex[1]);
-			vertexIndices.push_back(vertexIndex[2]);
-			uvIndices    .push_back(uvIndex[0]);
-			uvIndices    .push_back(uvIndex[1]);
-			uvIndices    .push_back(uvIndex[2]);
-			normalIndices.push_back(normalIndex[0]);
-			normalIndices.push_back(normalIndex[1]);
-			normalIndices.push_back(normalIndex[2]);
 		}else{
 			// Probably a comment, eat up the rest of the line
 			char stupidBuffer[1000];
@@ -1,100 +1,144 @@
 #include <vector>
-#include <map>
+#include <cmath>
 
 #include <glm/glm.hpp>
 
 #include "vboindexer.hpp"
 
-#include <string.h> // for memcmp
+#include <string.h> // for memcpy
 
 
-// Returns true iif v1 can be considered equal to v2
-bool is_near(float v1, float v2){
-	return fabs( v1-v2 ) < 0.01f;
+// Vertices are deduplicated with an open-addressing hash table keyed on their
+// attributes: position, UV and normal, 8 components per vertex. indexVBO keys
+// on the exact float bits (the same vertices the old std::map merged);
+// indexVBO_slow and indexVBO_TBN key on the attributes quantised to a
+// 0.01 grid, so vertices that round to the same cell share an index.
+// The table is sized up front for every input vertex being unique, so it
+// never grows and each lookup is O(1): indexing is linear in the corner count.
+// Output indices continue after any vertices already in out_XXXX.
+
+// Grid step of the quantised key (the old is_near() tolerance)
+static const float NEAR_QUANTUM = 0.01f;
+
+static const int VERTEX_KEY_WORDS = 8;
+
+struct VertexKey{
+	long long words[VERTEX_KEY_WORDS];
+	bool operator==(const VertexKey & that) const{
+		return memcmp(words, that.words, sizeof(words)) == 0;
+	}
+};
+
+// Exact key: the bit pattern of every component
+static long long exactWord(float value){
+	unsigned int bits;
+	memcpy(&bits, &value, sizeof(bits));
+	return bits;
 }
 
-// Searches through all already-exported vertices
-// for a similar one.
-// Similar = same position + same UVs + same normal
-bool getSimilarVertexIndex( 
-	glm::vec3 & in_vertex, 
-	glm::vec2 & in_uv, 
-	glm::vec3 & in_normal, 
-	std::vector<glm::vec3> & out_vertices,
-	std::vector<glm::vec2> & out_uvs,
-	std::vector<glm::vec3> & out_normals,
-	unsigned short & result
-){
-	// Lame linear search
-	for ( unsigned int i=0; i<out_vertices.size(); i++ ){
-		if (
-			is_near( in_vertex.x , out_vertices[i].x ) &&
-			is_near( in_vertex.y , out_vertices[i].y ) &&
-			is_near( in_vertex.z , out_vertices[i].z ) &&
-			is_near( in_uv.x     , out_uvs     [i].x ) &&
-			is_near( in_uv.y     , out_uvs     [i].y ) &&
-			is_near( in_normal.x , out_normals [i].x ) &&
-			is_near( in_normal.y , out_normals [i].y ) &&
-			is_near( in_normal.z , out_normals [i].z )
-		){
-			result = i;
-			return true;
-		}
+// Quantised key: the index of the grid cell a component rounds to
+static long long nearWord(float value){
+	return (long long)std::floor(value / NEAR_QUANTUM + 0.5f);
+}
+
+static VertexKey makeVertexKey(const glm::vec3 & vertex, const glm::vec2 & uv, const glm::vec3 & normal, bool quantise){
+	const float components[VERTEX_KEY_WORDS] = { vertex.x, vertex.y, vertex.z, uv.x, uv.y, normal.x, normal.y, normal.z };
+	VertexKey key;
+	for ( int k=0; k<VERTEX_KEY_WORDS; k++ ){
+		key.words[k] = quantise ? nearWord(components[k]) : exactWord(components[k]);
 	}
-	// No other vertex could be used instead.
-	// Looks like we'll have to add it to the VBO.
-	return false;
+	return key;
 }
 
-void indexVBO_slow(
+static unsigned long long hashVertexKey(const VertexKey & key){
+	unsigned long long hash = 0;
+	for ( int k=0; k<VERTEX_KEY_WORDS; k++ ){
+		hash = (hash ^ (unsigned long long)key.words[k]) * 0x9E3779B97F4A7C15ull;
+		hash ^= hash >> 29;
+	}
+	return hash;
+}
+
+// Linear-probing table from a vertex key to its output index
+class VertexIndexTable{
+public:
+	// Reserve for up to maxVertices unique vertices at a load factor of at most 1/2
+	explicit VertexIndexTable(size_t maxVertices){
+		size_t capacity = 16;
+		while ( capacity < 2 * maxVertices ){
+			capacity *= 2;
+		}
+		slots.assign(capacity, 0);
+		keys.reserve(maxVertices);
+		mask = capacity - 1;
+	}
+
+	// Index of the vertex with this key; newly added vertices get the next index and found = false
+	unsigned int findOrAdd(const VertexKey & key, bool & found){
+		size_t slot = (size_t)hashVertexKey(key) & mask;
+		while ( slots[slot] != 0 ){
+			unsigned int index = slots[slot] - 1;
+			if ( keys[index] == key ){
+				found = true;
+				return index;
+			}
+			slot = (slot + 1) & mask;
+		}
+		unsigned int index = (unsigned int)keys.size();
+		keys.push_back(key);
+		slots[slot] = index + 1; // 0 marks an empty slot
+		found = false;
+		return index;
+	}
+
+private:
+	std::vector<unsigned int> slots;
+	std::vector<VertexKey> keys; // Indexed by output vertex
+	size_t mask;
+};
+
+static void indexVertices(
 	std::vector<glm::vec3> & in_vertices,
 	std::vector<glm::vec2> & in_uvs,
 	std::vector<glm::vec3> & in_normals,
+	bool quantise,
 
-	std::vector<unsigned short> & out_indices,
+	std::vector<unsigned int> & out_indices,
 	std::vector<glm::vec3> & out_vertices,
 	std::vector<glm::vec2> & out_uvs,
 	std::vector<glm::vec3> & out_normals
 ){
+	VertexIndexTable table(in_vertices.size());
+	const unsigned int base = (unsigned int)out_vertices.size();
+	out_indices.reserve(out_indices.size() + in_vertices.size());
+
 	// For each input vertex
 	for ( unsigned int i=0; i<in_vertices.size(); i++ ){
 
 		// Try to find a similar vertex in out_XXXX
-		unsigned short index;
-		bool found = getSimilarVertexIndex(in_vertices[i], in_uvs[i], in_normals[i],     out_vertices, out_uvs, out_normals, index);
+		bool found;
+		unsigned int index = base + table.findOrAdd(makeVertexKey(in_vertices[i], in_uvs[i], in_normals[i], quantise), found);
 
-		if ( found ){ // A similar vertex is already in the VBO, use it instead !
-			out_indices.push_back( index );
-		}else{ // If not, it needs to be added in the output data.
+		if ( !found ){ // If not, it needs to be added in the output data.
 			out_vertices.push_back( in_vertices[i]);
 			out_uvs     .push_back( in_uvs[i]);
 			out_normals .push_back( in_normals[i]);
-			out_indices .push_back( (unsigned short)out_vertices.size() - 1 );
 		}
+		out_indices.push_back( index );
 	}
 }
 
-struct PackedVertex{
-	glm::vec3 position;
-	glm::vec2 uv;
-	glm::vec3 normal;
-	bool operator<(const PackedVertex that) const{
-		return memcmp((void*)this, (void*)&that, sizeof(PackedVertex))>0;
-	};
-};
+void indexVBO_slow(
+	std::vector<glm::vec3> & in_vertices,
+	std::vector<glm::vec2> & in_uvs,
+	std::vector<glm::vec3> & in_normals,
 
-bool getSimilarVertexIndex_fast( 
-	PackedVertex & packed, 
-	std::map<PackedVertex,unsigned short> & VertexToOutIndex,
-	unsigned short & result
+	std::vector<unsigned int> & out_indices,
+	std::vector<glm::vec3> & out_vertices,
+	std::vector<glm::vec2> & out_uvs,
+	std::vector<glm::vec3> & out_normals
 ){
-	std::map<PackedVertex,unsigned short>::iterator it = VertexToOutIndex.find(packed);
-	if ( it == VertexToOutIndex.end() ){
-		return false;
-	}else{
-		result = it->second;
-		return true;
-	}
+	indexVertices(in_vertices, in_uvs, in_normals, true, out_indices, out_vertices, out_uvs, out_normals);
 }
 
 void indexVBO(
@@ -102,34 +146,12 @@ void indexVBO(
 	std::vector<glm::vec2> & in_uvs,
 	std::vector<glm::vec3> & in_normals,
 
-	std::vector<unsigned short> & out_indices,
+	std::vector<unsigned int> & out_indices,
 	std::vector<glm::vec3> & out_vertices,
 	std::vector<glm::vec2> & out_uvs,
 	std::vector<glm::vec3> & out_normals
 ){
-	std::map<PackedVertex,unsigned short> VertexToOutIndex;
-
-	// For each input vertex
-	for ( unsigned int i=0; i<in_vertices.size(); i++ ){
-
-		PackedVertex packed = {in_vertices[i], in_uvs[i], in_normals[i]};
-		
-
-		// Try to find a similar vertex in out_XXXX
-		unsigned short index;
-		bool found = getSimilarVertexIndex_fast( packed, VertexToOutIndex, index);
-
-		if ( found ){ // A similar vertex is already in the VBO, use it instead !
-			out_indices.push_back( index );
-		}else{ // If not, it needs to be added in the output data.
-			out_vertices.push_back( in_vertices[i]);
-			out_uvs     .push_back( in_uvs[i]);
-			out_normals .push_back( in_normals[i]);
-			unsigned short newindex = (unsigned short)out_vertices.size() - 1;
-			out_indices .push_back( newindex );
-			VertexToOutIndex[ packed ] = newindex;
-		}
-	}
+	indexVertices(in_vertices, in_uvs, in_normals, false, out_indices, out_vertices, out_uvs, out_normals);
 }
 
 
@@ -145,19 +167,23 @@ void indexVBO_TBN(
 	std::vector<glm::vec3> & in_tangents,
 	std::vector<glm::vec3> & in_bitangents,
 
-	std::vector<unsigned short> & out_indices,
+	std::vector<unsigned int> & out_indices,
 	std::vector<glm::vec3> & out_vertices,
 	std::vector<glm::vec2> & out_uvs,
 	std::vector<glm::vec3> & out_normals,
 	std::vector<glm::vec3> & out_tangents,
 	std::vector<glm::vec3> & out_bitangents
 ){
+	VertexIndexTable table(in_vertices.size());
+	const unsigned int base = (unsigned int)out_vertices.size();
+	out_indices.reserve(out_indices.size() + in_vertices.size());
+
 	// For each input vertex
 	for ( unsigned int i=0; i<in_vertices.size(); i++ ){
 
 		// Try to find a similar vertex in out_XXXX
-		unsigned short index;
-		bool found = getSimilarVertexIndex(in_vertices[i], in_uvs[i], in_normals[i],     out_vertices, out_uvs, out_normals, index);
+		bool found;
+		unsigned int index = base + table.findOrAdd(makeVertexKey(in_vertices[i], in_uvs[i], in_normals[i], true), found);
 
 		if ( found ){ // A similar vertex is already in the VBO, use it instead !
 			out_indices.push_back( index );
@@ -171,7 +197,7 @@ void indexVBO_TBN(
 			out_normals .push_back( in_normals[i]);
 			out_tangents .push_back( in_tangents[i]);
 			out_bitangents .push_back( in_bitangents[i]);
-			out_indices .push_back( (unsigned short)out_vertices.size() - 1 );
+			out_indices .push_back( index );
 		}
 	}
 }
@@ -0,0 +1,176 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Entry point of uav_checks, the self-checks and micro-benchmarks of the physics
+core and of the renderer's GL-free parts. The first argument names the check;
+it prints its findings and exits with 0 on success. ctest runs every verify-*
+check with its defaults.
+
+Usage:
+    uav_checks verify-integrator|verify-collision|verify-pid|verify-membership|verify-instancing|
+               verify-trails|verify-vertex-packing|verify-indexing|bench-layout|bench-integrators|
+               bench-indexing
+               [--uavs N] [--duration SECONDS] [--dt SECONDS] [--seed N] [--threads N] [--assets DIR]
+--assets defaults to the source tree's assets directory, set at configure time.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include "Checks.h"
+#include "PhysicsGlobals.h"
+
+#ifndef UAV_ASSET_DIR
+#define UAV_ASSET_DIR "assets"
+#endif
+
+namespace
+{
+    // Command line of one check
+    struct CheckOptions
+    {
+        std::string check;
+        int uavCount = 15;
+        double durationSeconds = 10.0;
+        double timeStep = 0.01;
+        unsigned int seed = 1;
+        size_t threadCount = 0;
+        std::string assetDir = UAV_ASSET_DIR; // Directory holding models/
+    };
+
+    const char* const kChecks[] = {"verify-integrator", "verify-collision", "verify-pid", "verify-membership",
+                                   "verify-instancing", "verify-trails", "verify-vertex-packing", "verify-indexing",
+                                   "bench-layout", "bench-integrators", "bench-indexing"};
+
+    // Runs per model of bench-indexing; the fastest is reported
+    const int kIndexingRepeats = 5;
+
+    void printUsage(const char* program)
+    {
+        fprintf(stderr,
+                "Usage: %s verify-integrator|verify-collision|verify-pid|verify-membership|verify-instancing|\n"
+                "          verify-trails|verify-vertex-packing|verify-indexing|bench-layout|bench-integrators|\n"
+                "          bench-indexing\n"
+                "          [--uavs N] [--duration SECONDS] [--dt SECONDS] [--seed N] [--threads N] [--assets DIR]\n",
+                program);
+    }
+
+    /*
+    Parse the command line into options
+    Output: false on an unknown check or option, or a malformed value
+    */
+    bool parseOptions(int argc, char* argv[], CheckOptions& options)
+    {
+        if (argc < 2)
+        {
+            return false;
+        }
+        options.check = argv[1];
+        for (int arg = 2; arg < argc; ++arg)
+        {
+            const std::string option = argv[arg];
+            if (option == "--help" || option == "-h" || arg + 1 >= argc)
+            {
+                return false;
+            }
+            const std::string value = argv[++arg];
+
+            if (option == "--uavs")
+            {
+                options.uavCount = std::atoi(value.c_str());
+            }
+            else if (option == "--duration")
+            {
+                options.durationSeconds = std::atof(value.c_str());
+            }
+            else if (option == "--dt")
+            {
+                options.timeStep = std::atof(value.c_str());
+            }
+            else if (option == "--seed")
+            {
+                options.seed = static_cast<unsigned int>(std::strtoul(value.c_str(), nullptr, 10));
+            }
+            else if (option == "--threads")
+            {
+                options.threadCount = static_cast<size_t>(std::atoi(value.c_str()));
+            }
+            else if (option == "--assets")
+            {
+                options.assetDir = value;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        bool knownCheck = std::find(std::begin(kChecks), std::end(kChecks), options.check) != std::end(kChecks);
+        return knownCheck && options.uavCount > 0 && options.durationSeconds > 0.0 && options.timeStep > 0.0;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    CheckOptions options;
+    if (!parseOptions(argc, argv, options))
+    {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    // Physics globals as uav_sim_headless sets them by default
+    setBroadphaseType(BroadphaseType::SPATIAL_HASH);
+    setUAVBoundingRadius(0.1);
+    setRandomSeed(options.seed);
+    setContinuousCollision(true);
+
+    const unsigned long long tickCount = static_cast<unsigned long long>(std::ceil(options.durationSeconds / options.timeStep));
+    const std::string& check = options.check;
+    if (check == "verify-integrator")
+    {
+        return runIntegratorCheck(options.uavCount, tickCount, options.timeStep, options.seed);
+    }
+    if (check == "verify-collision")
+    {
+        return runCollisionCheck(std::max(1, options.uavCount / 2), options.seed);
+    }
+    if (check == "verify-pid")
+    {
+        return runPidBankCheck(options.uavCount, tickCount, options.timeStep, options.seed);
+    }
+    if (check == "verify-membership")
+    {
+        return runMembershipCheck(options.uavCount, tickCount, options.timeStep, options.seed);
+    }
+    if (check == "verify-instancing")
+    {
+        return runInstancingCheck(options.uavCount, tickCount, options.seed);
+    }
+    if (check == "verify-trails")
+    {
+        return runTrailStoreCheck(options.uavCount, tickCount, options.seed);
+    }
+    if (check == "verify-vertex-packing")
+    {
+        return runVertexPackingCheck(options.seed);
+    }
+    if (check == "verify-indexing")
+    {
+        return runIndexingCheck(options.assetDir, options.seed);
+    }
+    if (check == "bench-layout")
+    {
+        return runLayoutBenchmark(options.uavCount, options.threadCount, tickCount);
+    }
+    if (check == "bench-integrators")
+    {
+        return runIntegratorBenchmark(options.uavCount, tickCount);
+    }
+    return runIndexingBenchmark(options.assetDir, kIndexingRepeats);
+}
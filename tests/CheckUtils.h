@@ -0,0 +1,28 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Helpers shared by the uav_checks sources.
+*/
+
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+
+// Batches start at odd ids so vector loads are unaligned and every batch has a tail
+const size_t kCheckBatchSize = 37;
+
+inline double millisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+template <typename T>
+bool sameBits(T a, T b)
+{
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
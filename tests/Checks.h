@@ -0,0 +1,157 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Self-checks and micro-benchmarks run by uav_checks, one source per component
+under test. Each prints its findings and returns the process exit code (0 on
+success).
+*/
+
+#pragma once
+#include <cstddef>
+#include <string>
+
+/*
+Run the scalar and AVX2 integration kernels side by side on identical random
+swarms and require bit-identical results after every tick
+Input:
+    - uavCount: Swarm size (odd sizes exercise the scalar tail)
+    - tickCount: Ticks to integrate
+    - deltaTime: Time step (seconds)
+    - seed: Seed for the initial state and the per-tick forces
+Output: 0 if the kernels agree (or AVX2 is unavailable), 1 on the first mismatch
+*/
+int runIntegratorCheck(size_t uavCount, unsigned long long tickCount, double deltaTime, unsigned int seed);
+
+/*
+Fly head-on pairs of UAVs past each other at the 10 m/s orbit speed limit and
+count the contacts the collision pipeline reports, with the swept test and
+with the instantaneous end-of-step test, at 10, 20 and 50 ms time steps. The
+lateral miss distance of each pair is random, so whether it must collide is
+known exactly.
+Input:
+    - pairCount: Number of UAV pairs
+    - seed: Seed for the miss distances and start offsets
+Output: 0 if the swept test finds every collision and no false one at every
+        time step, 1 otherwise
+*/
+int runCollisionCheck(size_t pairCount, unsigned int seed);
+
+/*
+Drive a PIDBank (scalar and AVX2 kernels) and one PIDController per lane with
+the same random gains, limits, inputs and active/reset masks, and require
+bit-identical outputs and controller state after every tick
+Input:
+    - laneCount: Number of controllers (odd sizes exercise the scalar tail)
+    - tickCount: Evaluations per controller
+    - deltaTime: Time step (seconds)
+    - seed: Seed for the gains and per-tick inputs
+Output: 0 if all three agree, 1 on the first mismatch
+*/
+int runPidBankCheck(size_t laneCount, unsigned long long tickCount, double deltaTime, unsigned int seed);
+
+/*
+Measure the cost of cache lines shared between writing threads: per-thread
+counters packed into one line against counters padded to a line each, and
+the integration pass over batches that straddle cache lines (one UAV more
+than the default batch) against line-aligned default batches
+Input:
+    - uavCount: Swarm size for the integration pass
+    - threadCount: Threads taking part (at least 2; 0 selects the core count)
+    - tickCount: Integration passes per batch layout
+Output: 0 (timings only)
+*/
+int runLayoutBenchmark(size_t uavCount, size_t threadCount, unsigned long long tickCount);
+
+/*
+Compare the integrator policies: the cost of one step per UAV under the held
+control force (what the stepper integrates), and the largest time step each
+keeps stable on the orbit radial loop modelled in continuous time, a spring
+and damper on the radial error evaluated inside the step
+Input:
+    - uavCount: Swarm size for the cost measurement
+    - tickCount: Steps per policy for the cost measurement
+Output: 0 (measurements only)
+*/
+int runIntegratorBenchmark(size_t uavCount, unsigned long long tickCount);
+
+/*
+Launch and retire UAVs at random while the stepper runs, with reader threads
+walking the published membership the whole time. Readers check that every
+version they hold stays ascending and unchanged for as long as they hold it;
+after every tick the membership must list exactly the UAVs in service, and
+retired UAVs must be at rest and asleep. At the end every replaced version
+must have been reclaimed.
+Input:
+    - uavCount: Initial fleet size (the arena has room for half as many again)
+    - tickCount: Ticks to run
+    - deltaTime: Time step (seconds)
+    - seed: Seed for the launches and retirements
+Output: 0 if every check holds, 1 otherwise
+*/
+int runMembershipCheck(size_t uavCount, unsigned long long tickCount, double deltaTime, unsigned int seed);
+
+/*
+Pack the render instances of a random subset of a random swarm and compare
+every model matrix with one composed from translate, rotate and scale
+matrices, then time the packing
+Input:
+    - uavCount: Swarm size (a random three quarters of it is in service)
+    - tickCount: Frames packed for the timing
+    - seed: Seed for the positions, colour intensities and subset
+Output: 0 if grouping, order, matrices and intensities all match, 1 otherwise
+*/
+int runInstancingCheck(size_t uavCount, unsigned long long tickCount, unsigned int seed);
+
+/*
+Check the packed mesh vertex format: every half float must survive a round
+trip, random UVs must round to within half a half-float step, and random unit
+normals must keep every component within half a 10-bit step; then time the
+interleaving
+Input: seed - Seed for the UVs and normals
+Output: 0 if every conversion is within bounds, 1 otherwise
+*/
+int runVertexPackingCheck(unsigned int seed);
+
+/*
+Push random samples into a TrailStore, clearing a trail now and then and
+growing the store halfway through, and compare every trail with a deque of its
+last samples after every push: the run must stay inside the trail's block,
+list the samples newest first, and give them texture u from 0 at the newest
+to 1 at the oldest in equal steps, across every wrap of the head
+Input:
+    - trailCount: Trails after the growth (half of them before)
+    - pushCount: Samples pushed into each trail
+    - seed: Seed for the samples and clears
+Output: 0 if every trail matches after every push, 1 otherwise
+*/
+int runTrailStoreCheck(size_t trailCount, unsigned long long pushCount, unsigned int seed);
+
+/*
+Load and index every bundled model, plus a synthetic mesh with more unique
+vertices than 16-bit indices address. Every index must name a vertex with
+exactly the attributes of the corner it replaces, and the element buffer must
+use 16-bit indices only when they suffice. Each model, and a copy jittered
+within a grid step, also goes through the quantised indexVBO_slow and
+indexVBO_TBN: both must give the same indices, each naming a vertex within one
+0.01 step of its corner in every component, and the output tangents and
+bitangents must be the sums over the merged corners.
+Input:
+    - assetDir: Directory holding models/
+    - seed: Seed for the synthetic mesh
+Output: 0 if every mesh indexes and packs correctly, 1 otherwise
+*/
+int runIndexingCheck(const std::string& assetDir, unsigned int seed);
+
+/*
+Time indexVBO on every bundled model against the std::map indexer it
+replaced, which must produce the same indices and vertices, and time the
+quantised indexVBO_TBN
+Input:
+    - assetDir: Directory holding models/
+    - repeatCount: Runs per model and indexer; the fastest is reported
+Output: 0 if both indexers agree on every model, 1 otherwise
+*/
+int runIndexingBenchmark(const std::string& assetDir, int repeatCount);
@@ -0,0 +1,114 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Swept against end-of-step collision detection on head-on UAV pairs.
+*/
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "Checks.h"
+#include "PhysicsGlobals.h"
+#include "SwarmState.h"
+
+namespace
+{
+    // Pairs far enough apart to never meet another pair
+    const double kPairSpacing = 50.0;
+    const double kUavSpeed = 10.0; // Orbit speed limit
+}
+
+int runCollisionCheck(size_t pairCount, unsigned int seed)
+{
+    const double triggerDistance = getCollisionTriggerDistance();
+    const double timeSteps[] = {0.01, 0.02, 0.05};
+    const bool previousContinuous = isContinuousCollisionEnabled();
+
+    // Same pairs for every run: lateral miss distance and half the start gap
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> missDistribution(0.0, 2.0 * triggerDistance);
+    std::uniform_real_distribution<double> gapDistribution(1.0, 2.0);
+    std::vector<double> miss(pairCount);
+    std::vector<double> halfGap(pairCount);
+    size_t expectedHits = 0;
+    for (size_t k = 0; k < pairCount; ++k)
+    {
+        miss[k] = missDistribution(generator);
+        halfGap[k] = gapDistribution(generator);
+        expectedHits += miss[k] < triggerDistance ? 1 : 0;
+    }
+
+    printf("Collision check: %zu pairs closing at %.0f m/s, %zu within the %.3f m trigger distance\n",
+           pairCount, 2.0 * kUavSpeed, expectedHits, triggerDistance);
+
+    bool passed = true;
+    for (double deltaTime : timeSteps)
+    {
+        // Long enough for the widest pair to pass through
+        const unsigned long long tickCount =
+            static_cast<unsigned long long>(std::ceil(2.0 * 2.0 / (2.0 * kUavSpeed) / deltaTime)) + 2;
+
+        for (int continuous = 0; continuous < 2; ++continuous)
+        {
+            setContinuousCollision(continuous != 0);
+
+            // Unit mass, no forces and no gravity: straight lines at constant speed
+            SwarmState state(2 * pairCount);
+            for (size_t k = 0; k < pairCount; ++k)
+            {
+                const double x = kPairSpacing * k;
+                state.setVelocity(state.add(Vec3(x, -halfGap[k], 10.0), 1.0, 0.0), Vec3(0.0, kUavSpeed, 0.0));
+                state.setVelocity(state.add(Vec3(x + miss[k], halfGap[k], 10.0), 1.0, 0.0), Vec3(0.0, -kUavSpeed, 0.0));
+            }
+
+            // Detect only; resolving would change the paths being checked
+            std::vector<uint8_t> detected(pairCount, 0);
+            size_t crossPairContacts = 0;
+            for (unsigned long long tick = 0; tick < tickCount; ++tick)
+            {
+                state.integrate(0, state.size(), deltaTime);
+                updateCollisionBroadphase(state);
+                findCollisionContacts(state, 0, getCollisionPairCount());
+                colorCollisionContacts(state.size());
+                for (const CollisionPair& contact : getCollisionContacts())
+                {
+                    if (contact.a % 2 == 0 && contact.b == contact.a + 1)
+                    {
+                        detected[contact.a / 2] = 1;
+                    }
+                    else
+                    {
+                        crossPairContacts++;
+                    }
+                }
+            }
+
+            size_t found = 0;
+            size_t missed = 0;
+            size_t falseHits = 0;
+            for (size_t k = 0; k < pairCount; ++k)
+            {
+                const bool expected = miss[k] < triggerDistance;
+                found += expected && detected[k] ? 1 : 0;
+                missed += expected && !detected[k] ? 1 : 0;
+                falseHits += !expected && detected[k] ? 1 : 0;
+            }
+            falseHits += crossPairContacts;
+
+            printf("  %2.0f ms %-8s %zu/%zu collisions found, %zu tunnelled, %zu false\n",
+                   deltaTime * 1000.0, continuous ? "swept" : "discrete", found, expectedHits, missed, falseHits);
+            if (continuous && (missed > 0 || falseHits > 0))
+            {
+                passed = false;
+            }
+        }
+    }
+
+    setContinuousCollision(previousContinuous);
+    printf("Collision check: %s\n", passed ? "PASSED" : "FAILED");
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,139 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+InstancePacker matrices against translate, rotate and scale composition.
+*/
+
+#define _USE_MATH_DEFINES
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "Checks.h"
+#include "CheckUtils.h"
+#include "InstancePacker.h"
+
+namespace
+{
+    // Largest matrix entry error against the composed reference
+    const double kInstanceTolerance = 1e-4;
+
+    typedef std::array<double, 16> Matrix4; // Column-major, like glm::mat4
+
+    Matrix4 multiply(const Matrix4& a, const Matrix4& b)
+    {
+        Matrix4 product = {};
+        for (int column = 0; column < 4; ++column)
+        {
+            for (int row = 0; row < 4; ++row)
+            {
+                for (int k = 0; k < 4; ++k)
+                {
+                    product[column * 4 + row] += a[k * 4 + row] * b[column * 4 + k];
+                }
+            }
+        }
+        return product;
+    }
+
+    // Rotation by angle about the unit axis (x, y, z), as glm::rotate builds it
+    Matrix4 rotation(double angle, double x, double y, double z)
+    {
+        const double c = std::cos(angle);
+        const double s = std::sin(angle);
+        const double t = 1.0 - c;
+        return Matrix4{{t * x * x + c,     t * x * y + s * z, t * x * z - s * y, 0.0,
+                        t * x * y - s * z, t * y * y + c,     t * y * z + s * x, 0.0,
+                        t * x * z + s * y, t * y * z - s * x, t * z * z + c,     0.0,
+                        0.0, 0.0, 0.0, 1.0}};
+    }
+}
+
+int runInstancingCheck(size_t uavCount, unsigned long long tickCount, unsigned int seed)
+{
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> coordinate(-250.0, 250.0);
+    std::uniform_real_distribution<float> intensity(0.5f, 1.0f);
+    std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+    std::uniform_int_distribution<int> inService(0, 3);
+
+    SwarmSnapshot snapshot;
+    std::vector<uint32_t> ids;
+    for (size_t id = 0; id < uavCount; ++id)
+    {
+        snapshot.positions.push_back(Vec3(coordinate(generator), coordinate(generator), coordinate(generator) + 250.0));
+        snapshot.colorIntensity.push_back(intensity(generator));
+        snapshot.orbitCompleted.push_back(0);
+        if (inService(generator) != 0)
+        {
+            ids.push_back(static_cast<uint32_t>(id));
+        }
+    }
+
+    InstancePacker packer;
+    const float scales[kModelGroupCount] = {0.25f, 0.1f, 0.04f};
+    for (size_t group = 0; group < kModelGroupCount; ++group)
+    {
+        packer.setGroupScale(group, scales[group]);
+    }
+    const float spinAngle = angle(generator);
+    packer.pack(snapshot, ids, spinAngle);
+
+    // Reference: translate * rotateX(90 deg) * rotateY(spin) * scale, as the per-UAV loop composed it
+    const Matrix4 upright = multiply(rotation(M_PI / 2.0, 1, 0, 0), rotation(spinAngle, 0, 1, 0));
+    bool passed = packer.getInstanceCount() == ids.size();
+    double maxError = 0.0;
+    size_t next[kModelGroupCount];
+    for (size_t group = 0; group < kModelGroupCount; ++group)
+    {
+        next[group] = packer.getGroupBegin(group);
+        passed = passed && (group == 0 || packer.getGroupBegin(group) ==
+                            packer.getGroupBegin(group - 1) + packer.getGroupCount(group - 1));
+    }
+    for (uint32_t id : ids)
+    {
+        const size_t group = InstancePacker::getModelGroup(id);
+        const size_t slot = next[group]++;
+        if (slot >= packer.getGroupBegin(group) + packer.getGroupCount(group))
+        {
+            passed = false;
+            break;
+        }
+        const double scale = scales[group];
+        const Vec3& p = snapshot.positions[id];
+        const Matrix4 translate = {{1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, p.x, p.y, p.z, 1}};
+        const Matrix4 scaling = {{scale, 0, 0, 0, 0, scale, 0, 0, 0, 0, scale, 0, 0, 0, 0, 1}};
+        const Matrix4 expected = multiply(multiply(translate, upright), scaling);
+
+        const UavInstance& instance = packer.getInstances()[slot];
+        for (int k = 0; k < 16; ++k)
+        {
+            const double error = std::fabs(instance.model[k] - expected[k]) / std::max(1.0, std::fabs(expected[k]));
+            maxError = std::max(maxError, error);
+        }
+        passed = passed && instance.colorIntensity == snapshot.colorIntensity[id];
+    }
+    passed = passed && maxError <= kInstanceTolerance;
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned long long frame = 0; frame < tickCount; ++frame)
+    {
+        packer.pack(snapshot, ids, spinAngle + static_cast<float>(frame));
+    }
+    const double packMs = millisecondsSince(start);
+
+    printf("Instancing check: %zu of %zu UAVs packed into groups of %zu, %zu and %zu, largest matrix error %.2e\n",
+           ids.size(), uavCount, packer.getGroupCount(0), packer.getGroupCount(1), packer.getGroupCount(2), maxError);
+    printf("  packing %.2f ns/instance, %zu bytes uploaded per frame\n",
+           tickCount > 0 && !ids.empty() ? packMs * 1e6 / (static_cast<double>(tickCount) * ids.size()) : 0.0,
+           ids.size() * sizeof(UavInstance));
+    printf("Instancing check: %s\n", passed ? "PASSED" : "FAILED");
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,124 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Cost and stable step of the integrator policies in Integrators.h.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include "Checks.h"
+#include "CheckUtils.h"
+#include "Integrators.h"
+#include "SwarmState.h"
+#include "SwarmStepper.h"
+
+namespace
+{
+    // Stability runs last this long, the last part must decay
+    const double kStabilitySeconds = 60.0;
+    const double kStabilityTailSeconds = 10.0;
+    const double kStabilityOffset = 1.0; // Initial radial error (meters)
+
+    /*
+    Orbit radial loop in continuous time: spring on the radial error and
+    damper on the radial speed, per unit mass, around the 10 m sphere
+    */
+    template <typename T>
+    struct RadialSpringDamper
+    {
+        BasicVec3<T> operator()(size_t, const BasicVec3<T>& position, const BasicVec3<T>& velocity) const
+        {
+            const BasicVec3<T> offset = position - BasicVec3<T>(0, 0, 50);
+            const T radius = offset.magnitude();
+            const BasicVec3<T> direction = offset / radius;
+            return direction * (-(stiffness * (radius - T(10)) + damping * velocity.dot(direction)));
+        }
+
+        T stiffness;
+        T damping;
+    };
+
+    /*
+    Largest step, on a 2% grid from 5 ms, for which the radial loop started
+    kStabilityOffset outside the sphere stays below that offset over the
+    last kStabilityTailSeconds of the run
+    */
+    template <typename Integrator>
+    double findLargestStableStep(double stiffness, double damping)
+    {
+        const RadialSpringDamper<PhysicsScalar> model = {static_cast<PhysicsScalar>(stiffness),
+                                                         static_cast<PhysicsScalar>(damping)};
+        double largest = 0.0;
+        for (double deltaTime = 0.005; deltaTime < 5.0; deltaTime *= 1.02)
+        {
+            SwarmState state(1);
+            state.add(Vec3(10.0 + kStabilityOffset, 0, 50), 1, 0);
+
+            const unsigned long long steps = static_cast<unsigned long long>(kStabilitySeconds / deltaTime);
+            const unsigned long long tailStart = steps - static_cast<unsigned long long>(kStabilityTailSeconds / deltaTime);
+            bool stable = true;
+            for (unsigned long long step = 0; step < steps && stable; ++step)
+            {
+                Integrator::step(state, 0, 1, deltaTime, model);
+                const double error = std::fabs(Vec3(state.getPosition(0)).distance(Vec3(0, 0, 50)) - 10.0);
+                stable = std::isfinite(error) && (step < tailStart || error < kStabilityOffset);
+            }
+            if (!stable)
+            {
+                break;
+            }
+            largest = deltaTime;
+        }
+        return largest;
+    }
+
+    // One policy's line of the integrator benchmark
+    template <typename Integrator>
+    void benchmarkIntegrator(size_t uavCount, unsigned long long tickCount)
+    {
+        SwarmState state(uavCount);
+        for (size_t i = 0; i < uavCount; ++i)
+        {
+            state.add(Vec3(static_cast<double>(i % 1000), static_cast<double>(i / 1000), 10.0), 1.0, 10.0);
+            state.setVelocity(i, Vec3(1.0, 0.5, 0.0));
+            state.setControlForce(i, Vec3(0.1, 0.0, 10.0));
+        }
+
+        const size_t batchSize = SwarmStepper::getDefaultBatchSize();
+        auto integratePass = [&]()
+        {
+            for (size_t begin = 0; begin < uavCount; begin += batchSize)
+            {
+                Integrator::integrate(state, begin, std::min(uavCount, begin + batchSize), 0.01);
+            }
+        };
+        integratePass(); // Warm up caches
+
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned long long tick = 0; tick < tickCount; ++tick)
+        {
+            integratePass();
+        }
+        const double nsPerUavTick = millisecondsSince(start) * 1.0e6 / (static_cast<double>(tickCount) * uavCount);
+
+        printf("  %-6s %6.2f ns/UAV-tick, largest stable step %.3f s (radial loop), %.3f s (former orbit PID)\n",
+               getIntegratorTypeName(Integrator::type), nsPerUavTick,
+               findLargestStableStep<Integrator>(8.0, 2.0), findLargestStableStep<Integrator>(8.0, 5.0));
+    }
+}
+
+int runIntegratorBenchmark(size_t uavCount, unsigned long long tickCount)
+{
+    printf("Integrator benchmark: cost over %zu UAVs x %llu steps under the held control force,\n", uavCount, tickCount);
+    printf("  stability of the radial loop with Kp 8 and damping 2 (fleet) or 5 (former orbit PID, Kd 3 added)\n");
+    benchmarkIntegrator<ConstantAccelerationIntegrator>(uavCount, tickCount);
+    benchmarkIntegrator<SemiImplicitEulerIntegrator>(uavCount, tickCount);
+    benchmarkIntegrator<VelocityVerletIntegrator>(uavCount, tickCount);
+    benchmarkIntegrator<Rk4Integrator>(uavCount, tickCount);
+    return 0;
+}
@@ -0,0 +1,122 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Cost of cache lines shared between writing threads.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include "AlignedAllocator.h"
+#include "Checks.h"
+#include "CheckUtils.h"
+#include "SwarmState.h"
+#include "SwarmStepper.h"
+#include "WorkerPool.h"
+
+namespace
+{
+    // Writes per thread and counter layouts
+    const unsigned long long kCounterWrites = 20000000;
+
+    typedef std::atomic<unsigned long long> Counter;
+
+    struct PaddedCounter
+    {
+        Counter value;
+        char padding[kCacheLineBytes - sizeof(Counter)];
+    };
+
+    /*
+    Each thread stores increments to its own counter, like the per-thread
+    statistics of the physics core
+    Output: Wall time in milliseconds
+    */
+    template <typename CounterAt>
+    double timeCounterWrites(size_t threadCount, CounterAt counterAt)
+    {
+        std::vector<std::thread> threads;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t t = 0; t < threadCount; ++t)
+        {
+            threads.emplace_back([t, &counterAt]()
+            {
+                Counter& counter = counterAt(t);
+                for (unsigned long long k = 0; k < kCounterWrites; ++k)
+                {
+                    counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        return millisecondsSince(start);
+    }
+}
+
+int runLayoutBenchmark(size_t uavCount, size_t threadCount, unsigned long long tickCount)
+{
+    if (threadCount == 0)
+    {
+        threadCount = std::thread::hardware_concurrency();
+    }
+    threadCount = std::max<size_t>(2, threadCount);
+    printf("Layout benchmark: %zu threads on %u hardware threads\n", threadCount, std::thread::hardware_concurrency());
+
+    // Per-thread counters sharing one cache line, then one line each
+    std::vector<Counter, AlignedAllocator<Counter>> packed(threadCount);
+    std::vector<PaddedCounter, AlignedAllocator<PaddedCounter>> padded(threadCount);
+    for (size_t t = 0; t < threadCount; ++t)
+    {
+        packed[t].store(0);
+        padded[t].value.store(0);
+    }
+    double packedMs = timeCounterWrites(threadCount, [&](size_t t) -> Counter& { return packed[t]; });
+    double paddedMs = timeCounterWrites(threadCount, [&](size_t t) -> Counter& { return padded[t].value; });
+    const double writes = static_cast<double>(kCounterWrites) * threadCount;
+    printf("  per-thread counters: packed %.2f ns/write, padded %.2f ns/write (%.2fx)\n",
+           packedMs * 1.0e6 / writes, paddedMs * 1.0e6 / writes, packedMs / paddedMs);
+
+    // Integration pass over a moving swarm with both batch layouts
+    SwarmState state(uavCount);
+    for (size_t i = 0; i < uavCount; ++i)
+    {
+        state.add(Vec3(static_cast<double>(i % 1000), static_cast<double>(i / 1000), 10.0), 1.0, 10.0);
+        state.setVelocity(i, Vec3(1.0, 0.5, 0.0));
+        state.setControlForce(i, Vec3(0.1, 0.0, 10.0));
+    }
+
+    WorkerPool pool(threadCount);
+    auto integratePass = [&](size_t batchSize)
+    {
+        pool.parallelFor(state.size(), batchSize, [&](size_t begin, size_t end)
+        {
+            state.integrate(begin, end, 0.01);
+        });
+    };
+    integratePass(SwarmStepper::getDefaultBatchSize()); // Warm up caches and the pool
+
+    const size_t alignedBatch = SwarmStepper::getDefaultBatchSize();
+    const size_t batches[2] = {alignedBatch + 1, alignedBatch};
+    const char* const names[2] = {"straddling lines", "line-aligned"};
+    for (int layout = 0; layout < 2; ++layout)
+    {
+        const size_t batchSize = batches[layout];
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned long long tick = 0; tick < tickCount; ++tick)
+        {
+            integratePass(batchSize);
+        }
+        printf("  integration, %zu UAVs in batches of %zu (%s): %.3f ms/tick\n",
+               uavCount, batchSize, names[layout], millisecondsSince(start) / tickCount);
+    }
+    return 0;
+}
@@ -0,0 +1,165 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Runtime launches and retirements against concurrent SwarmMembership readers.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+#include "Checks.h"
+#include "ECE_UAV.h"
+#include "PhysicsGlobals.h"
+#include "SimClock.h"
+#include "SwarmMembership.h"
+#include "SwarmState.h"
+#include "SwarmStepper.h"
+#include "UavArena.h"
+
+namespace
+{
+    // Reader threads and the most requests of each kind per tick
+    const size_t kMembershipReaders = 3;
+    const int kMaxRetiresPerTick = 2;
+    const int kMaxLaunchesPerTick = 3;
+
+    // Order-dependent fold of a membership list, recomputed to spot a version changing under a reader
+    uint64_t foldIds(const std::vector<uint32_t>& ids)
+    {
+        uint64_t hash = 14695981039346656037ull;
+        for (uint32_t id : ids)
+        {
+            hash = (hash ^ id) * 1099511628211ull;
+        }
+        return hash;
+    }
+}
+
+int runMembershipCheck(size_t uavCount, unsigned long long tickCount, double deltaTime, unsigned int seed)
+{
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> field(-100.0, 100.0);
+
+    SimClock clock(deltaTime, SimClockMode::LOCKSTEP);
+    SwarmState state(uavCount);
+    UavArena arena(uavCount + uavCount / 2);
+    std::vector<ECE_UAV*> uavs;
+    std::vector<ECE_UAV*>* previousList = GLOBAL_UAV_LIST;
+    GLOBAL_UAV_LIST = &uavs;
+    for (size_t k = 0; k < uavCount; ++k)
+    {
+        uavs.push_back(arena.create(state, clock, Vec3(field(generator), field(generator), 0.0)));
+    }
+
+    bool passed = true;
+    {
+        SwarmStepper stepper(state, clock, uavs);
+        stepper.setUavArena(&arena);
+        SwarmMembership& membership = stepper.getMembership();
+
+        printf("Membership check: %zu UAVs (arena for %zu), %llu ticks, %zu reader threads\n",
+               uavCount, arena.getCapacity(), tickCount, kMembershipReaders);
+
+        // Readers hold each version across a yield, so publishes overlap read sections
+        std::atomic<bool> stopReaders(false);
+        std::atomic<unsigned long long> reads(0);
+        std::atomic<unsigned long long> readerErrors(0);
+        std::vector<std::thread> readers;
+        for (size_t r = 0; r < kMembershipReaders; ++r)
+        {
+            readers.emplace_back([&]()
+            {
+                const size_t slot = membership.registerReader();
+                unsigned long long lastNumber = 0;
+                while (!stopReaders.load())
+                {
+                    SwarmMembership::ReadGuard guard(membership, slot);
+                    const MembershipVersion& version = guard.get();
+                    const uint64_t before = foldIds(version.ids);
+                    bool valid = version.number >= lastNumber &&
+                                 std::is_sorted(version.ids.begin(), version.ids.end()) &&
+                                 std::adjacent_find(version.ids.begin(), version.ids.end()) == version.ids.end();
+                    std::this_thread::yield();
+                    valid = valid && foldIds(version.ids) == before;
+                    readerErrors.fetch_add(valid ? 0 : 1);
+                    lastNumber = version.number;
+                    reads.fetch_add(1, std::memory_order_relaxed);
+                }
+                membership.unregisterReader(slot);
+            });
+        }
+
+        const size_t checkSlot = membership.registerReader();
+        size_t maxPending = 0;
+        unsigned long long invariantErrors = 0;
+        std::uniform_int_distribution<int> retireCount(0, kMaxRetiresPerTick);
+        std::uniform_int_distribution<int> launchCount(0, kMaxLaunchesPerTick);
+        for (unsigned long long tick = 0; tick < tickCount; ++tick)
+        {
+            {
+                SwarmMembership::ReadGuard guard(membership, checkSlot);
+                const std::vector<uint32_t>& ids = guard.ids();
+                for (int k = retireCount(generator); k > 0 && !ids.empty(); --k)
+                {
+                    stepper.requestRetire(ids[std::uniform_int_distribution<size_t>(0, ids.size() - 1)(generator)]);
+                }
+            }
+            for (int k = launchCount(generator); k > 0; --k)
+            {
+                stepper.requestLaunch(Vec3(field(generator), field(generator), 0.0));
+            }
+            stepper.step();
+
+            // The stepper is idle between ticks, so the store can be compared with the membership
+            SwarmMembership::ReadGuard guard(membership, checkSlot);
+            std::vector<uint32_t> inService;
+            size_t retired = 0;
+            for (size_t id = 0; id < state.size(); ++id)
+            {
+                if (!state.retired[id])
+                {
+                    inService.push_back(static_cast<uint32_t>(id));
+                    continue;
+                }
+                retired++;
+                const bool atRest = state.asleep[id] && state.vx[id] == 0 && state.vy[id] == 0 && state.vz[id] == 0 &&
+                                    state.getPosition(id).distance(state.getPreviousPosition(id)) == 0;
+                invariantErrors += atRest ? 0 : 1;
+            }
+            invariantErrors += (inService != guard.ids() || retired != state.retiredCount ||
+                                state.size() != uavs.size()) ? 1 : 0;
+            maxPending = std::max(maxPending, membership.getStats().pending);
+        }
+
+        stopReaders.store(true);
+        for (std::thread& reader : readers)
+        {
+            reader.join();
+        }
+        membership.unregisterReader(checkSlot);
+
+        // With every reader quiescent the next tick frees what is left
+        stepper.step();
+        const MembershipStats membershipStats = membership.getStats();
+        const SwarmStepperStats stats = stepper.getStats();
+
+        printf("  %llu launched (%llu into retired slots, %zu UAVs after growth), %llu retired, %llu launches dropped\n",
+               stats.launched, stats.reusedSlots, uavs.size(), stats.retired, stats.launchesDropped);
+        printf("  %llu versions published, %llu reclaimed, up to %zu awaiting readers; %llu reads, %llu reader errors, %llu invariant errors\n",
+               membershipStats.published, membershipStats.reclaimed, maxPending, reads.load(), readerErrors.load(),
+               invariantErrors);
+        passed = readerErrors.load() == 0 && invariantErrors == 0 && membershipStats.pending == 0 &&
+                 membershipStats.reclaimed == membershipStats.published &&
+                 membershipStats.published == membership.getVersionNumber() && stats.reusedSlots > 0;
+    }
+
+    GLOBAL_UAV_LIST = previousList;
+    printf("Membership check: %s\n", passed ? "PASSED" : "FAILED");
+    return passed ? 0 : 1;
+}
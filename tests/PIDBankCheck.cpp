@@ -0,0 +1,139 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Bit-identity check of the PIDBank kernels against PIDController.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "Checks.h"
+#include "CheckUtils.h"
+#include "PIDBank.h"
+#include "PIDController.h"
+#include "SwarmState.h"
+
+int runPidBankCheck(size_t laneCount, unsigned long long tickCount, double deltaTime, unsigned int seed)
+{
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> gain(0.0, 10.0);
+    std::uniform_real_distribution<double> limit(0.1, 100.0); // Small limits make the clamp bite
+    std::uniform_real_distribution<double> value(-20.0, 20.0);
+    std::uniform_int_distribution<int> percent(0, 99);
+
+    // The bank's defaults are overridden lane by lane, like the fleet does
+    PIDBank scalar(laneCount);
+    PIDBank vector(laneCount);
+    // Reference controllers of the bank's scalar type
+    std::vector<BasicPIDController<PhysicsScalar>> reference;
+    reference.reserve(laneCount);
+    scalar.setGains(1.0, 0.5, 0.25);
+    vector.setGains(1.0, 0.5, 0.25);
+    for (size_t i = 0; i < laneCount; ++i)
+    {
+        scalar.add();
+        vector.add();
+        reference.emplace_back(1.0, 0.5, 0.25);
+        if (percent(generator) < 75)
+        {
+            const double kp = gain(generator), ki = gain(generator), kd = gain(generator);
+            scalar.setGains(i, kp, ki, kd);
+            vector.setGains(i, kp, ki, kd);
+            reference[i].setGains(kp, ki, kd);
+        }
+        const double bound = limit(generator);
+        scalar.setIntegralLimits(i, -bound, bound);
+        vector.setIntegralLimits(i, -bound, bound);
+        reference[i].setIntegralLimits(-bound, bound);
+    }
+
+    const bool avx2 = SwarmState::isAvx2Supported();
+    std::vector<PhysicsScalar> expected(laneCount, 0);
+    double referenceMs = 0.0;
+    double scalarMs = 0.0;
+    double vectorMs = 0.0;
+    for (unsigned long long tick = 0; tick < tickCount; ++tick)
+    {
+        // Most lanes run every tick; some sit out, some restart from zero
+        for (size_t i = 0; i < laneCount; ++i)
+        {
+            const double setpoint = value(generator);
+            const double measurement = value(generator);
+            const bool active = percent(generator) < 90;
+            const bool reset = percent(generator) < 3;
+            for (PIDBank* bank : {&scalar, &vector})
+            {
+                bank->setInput(i, setpoint, measurement);
+                bank->setActive(i, active);
+                if (reset)
+                {
+                    bank->reset(i);
+                }
+            }
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < laneCount; ++i)
+        {
+            if (scalar.resetMask[i])
+            {
+                reference[i].reset();
+            }
+            if (scalar.isActive(i))
+            {
+                expected[i] = reference[i].calculate(scalar.setpoint[i], scalar.measurement[i],
+                                                     static_cast<PhysicsScalar>(deltaTime));
+            }
+        }
+        referenceMs += millisecondsSince(start);
+
+        start = std::chrono::steady_clock::now();
+        scalar.calculateScalar(0, laneCount, deltaTime);
+        scalarMs += millisecondsSince(start);
+
+        start = std::chrono::steady_clock::now();
+        for (size_t begin = 0; begin < laneCount; begin += kCheckBatchSize)
+        {
+            const size_t end = std::min(laneCount, begin + kCheckBatchSize);
+            if (avx2)
+            {
+                vector.calculateAvx2(begin, end, deltaTime);
+            }
+            else
+            {
+                vector.calculateScalar(begin, end, deltaTime);
+            }
+        }
+        vectorMs += millisecondsSince(start);
+
+        for (size_t i = 0; i < laneCount; ++i)
+        {
+            const PhysicsScalar values[][3] = {
+                {expected[i], scalar.output[i], vector.output[i]},
+                {0, scalar.integral[i], vector.integral[i]},
+                {0, scalar.previousError[i], vector.previousError[i]}};
+            const char* const names[] = {"output", "integral", "previous error"};
+            for (size_t v = 0; v < 3; ++v)
+            {
+                // The reference keeps its state private, so only outputs are compared to it
+                const bool referenceMatches = v > 0 || sameBits(values[v][0], values[v][1]);
+                if (!referenceMatches || !sameBits(values[v][1], values[v][2]))
+                {
+                    printf("PID bank check: FAILED at tick %llu, lane %zu, %s: PIDController %.17g, scalar %.17g, %s %.17g\n",
+                           tick, i, names[v], values[v][0], values[v][1], avx2 ? "avx2" : "batched", values[v][2]);
+                    return 1;
+                }
+            }
+        }
+    }
+
+    printf("PID bank check: PASSED, %zu lanes x %llu ticks bit-identical to PIDController\n", laneCount, tickCount);
+    printf("  PIDController %.3f ms, bank scalar %.3f ms, bank %s %.3f ms\n",
+           referenceMs, scalarMs, avx2 ? "avx2" : "scalar (no AVX2)", vectorMs);
+    return 0;
+}
@@ -0,0 +1,102 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Bit-identity check of the scalar and AVX2 SwarmState integration kernels.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include "Checks.h"
+#include "CheckUtils.h"
+#include "SwarmState.h"
+
+int runIntegratorCheck(size_t uavCount, unsigned long long tickCount, double deltaTime, unsigned int seed)
+{
+    if (!SwarmState::isAvx2Supported())
+    {
+        printf("Integrator check: AVX2 not available on this CPU/build, only the scalar kernel is used\n");
+        return 0;
+    }
+
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> lateral(-100.0, 100.0);
+    std::uniform_real_distribution<double> height(-0.5, 60.0); // Some start below ground
+    std::uniform_real_distribution<double> speed(-5.0, 5.0);
+    std::uniform_real_distribution<double> massDistribution(0.5, 2.0);
+
+    SwarmState scalar(uavCount);
+    SwarmState vector(uavCount);
+    for (size_t i = 0; i < uavCount; ++i)
+    {
+        const Vec3 position(lateral(generator), lateral(generator), height(generator));
+        const double mass = massDistribution(generator);
+        scalar.add(position, mass, 10.0 * mass);
+        vector.add(position, mass, 10.0 * mass);
+
+        const Vec3 velocity(speed(generator), speed(generator), speed(generator));
+        scalar.setVelocity(i, velocity);
+        vector.setVelocity(i, velocity);
+    }
+
+    // Thrust below hover for part of the swarm so UAVs keep hitting the ground
+    std::uniform_real_distribution<double> lateralForce(-20.0, 20.0);
+    std::uniform_real_distribution<double> verticalForce(0.0, 20.0);
+
+    const SwarmState::Array SwarmState::* const checked[] = {
+        &SwarmState::px, &SwarmState::py, &SwarmState::pz,
+        &SwarmState::prevPx, &SwarmState::prevPy, &SwarmState::prevPz,
+        &SwarmState::vx, &SwarmState::vy, &SwarmState::vz,
+        &SwarmState::ax, &SwarmState::ay, &SwarmState::az};
+    const char* const checkedNames[] = {"px", "py", "pz", "prevPx", "prevPy", "prevPz", "vx", "vy", "vz", "ax", "ay", "az"};
+
+    double scalarMs = 0.0;
+    double vectorMs = 0.0;
+    for (unsigned long long tick = 0; tick < tickCount; ++tick)
+    {
+        for (size_t i = 0; i < uavCount; ++i)
+        {
+            const Vec3 force(lateralForce(generator), lateralForce(generator), verticalForce(generator));
+            scalar.setControlForce(i, force);
+            vector.setControlForce(i, force);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (size_t begin = 0; begin < uavCount; begin += kCheckBatchSize)
+        {
+            scalar.integrateScalar(begin, std::min(uavCount, begin + kCheckBatchSize), deltaTime);
+        }
+        scalarMs += millisecondsSince(start);
+
+        start = std::chrono::steady_clock::now();
+        for (size_t begin = 0; begin < uavCount; begin += kCheckBatchSize)
+        {
+            vector.integrateAvx2(begin, std::min(uavCount, begin + kCheckBatchSize), deltaTime);
+        }
+        vectorMs += millisecondsSince(start);
+
+        for (size_t a = 0; a < sizeof(checked) / sizeof(checked[0]); ++a)
+        {
+            const SwarmState::Array& expected = scalar.*checked[a];
+            const SwarmState::Array& actual = vector.*checked[a];
+            for (size_t i = 0; i < uavCount; ++i)
+            {
+                if (!sameBits(expected[i], actual[i]))
+                {
+                    printf("Integrator check: FAILED at tick %llu, UAV %zu, %s: scalar %.17g, avx2 %.17g\n",
+                           tick, i, checkedNames[a], expected[i], actual[i]);
+                    return 1;
+                }
+            }
+        }
+    }
+
+    printf("Integrator check: PASSED, %zu UAVs x %llu ticks bit-identical\n", uavCount, tickCount);
+    printf("  scalar %.3f ms, avx2 %.3f ms (%.2fx)\n", scalarMs, vectorMs,
+           vectorMs > 0.0 ? scalarMs / vectorMs : 0.0);
+    return 0;
+}
@@ -0,0 +1,105 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Doubled-ring TrailStore against one std::deque per trail.
+*/
+
+#include <cstdio>
+#include <deque>
+#include <random>
+#include <vector>
+#include "Checks.h"
+#include "TrailStore.h"
+
+namespace
+{
+    // Short trails so the head wraps many times
+    const size_t kTrailLength = 7;
+
+    // Percent chance per push that the trail is cleared first, as when a UAV retires
+    const int kClearPercent = 2;
+
+    /*
+    Compare one trail with its reference
+    Output: true if the run lies in the trail's block, holds the reference
+            samples newest first, and its u runs from 0 to 1 in equal steps
+    */
+    bool checkTrail(const TrailStore& trails, size_t trail, const std::deque<TrailPoint>& expected)
+    {
+        const size_t blockBegin = trail * 2 * kTrailLength;
+        const size_t first = trails.getFirst(trail);
+        const size_t count = trails.getCount(trail);
+        if (count != expected.size() || first < blockBegin || first + count > blockBegin + 2 * kTrailLength)
+        {
+            return false;
+        }
+        for (size_t k = 0; k < count; ++k)
+        {
+            const TrailPoint& point = trails.getVertices()[first + k];
+            const float u = trails.getTextureCoordinate(first + k);
+            const float expectedU = count < 2 ? 0.0f : static_cast<float>(k) / static_cast<float>(count - 1);
+            if (point.x != expected[k].x || point.y != expected[k].y || point.z != expected[k].z || u != expectedU)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int runTrailStoreCheck(size_t trailCount, unsigned long long pushCount, unsigned int seed)
+{
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<float> coordinate(-100.0f, 100.0f);
+    std::uniform_int_distribution<int> percent(0, 99);
+
+    // Start with half the trails and grow to all of them halfway through, like reinforcements
+    TrailStore trails(kTrailLength);
+    const size_t initialCount = (trailCount + 1) / 2;
+    trails.resize(initialCount);
+    std::vector<std::deque<TrailPoint>> expected(initialCount);
+
+    size_t clears = 0;
+    bool passed = true;
+    for (unsigned long long push = 0; push < pushCount && passed; ++push)
+    {
+        if (push == pushCount / 2 && trails.getTrailCount() < trailCount)
+        {
+            trails.resize(trailCount);
+            expected.resize(trailCount);
+        }
+        for (size_t trail = 0; trail < trails.getTrailCount(); ++trail)
+        {
+            if (percent(generator) < kClearPercent)
+            {
+                trails.clear(trail);
+                expected[trail].clear();
+                clears++;
+            }
+            const TrailPoint point = {coordinate(generator), coordinate(generator), coordinate(generator)};
+            trails.push(trail, point);
+            expected[trail].push_front(point);
+            if (expected[trail].size() > kTrailLength)
+            {
+                expected[trail].pop_back();
+            }
+        }
+        for (size_t trail = 0; trail < trails.getTrailCount() && passed; ++trail)
+        {
+            if (!checkTrail(trails, trail, expected[trail]))
+            {
+                printf("Trail store check: FAILED at push %llu, trail %zu (first %zu, count %zu)\n",
+                       push, trail, trails.getFirst(trail), trails.getCount(trail));
+                passed = false;
+            }
+        }
+    }
+
+    printf("Trail store check: %zu trails of %zu samples, %llu pushes each, %zu clears\n",
+           trails.getTrailCount(), kTrailLength, pushCount, clears);
+    printf("Trail store check: %s\n", passed ? "PASSED" : "FAILED");
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,348 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Correctness and speed of indexVBO on the bundled models and a synthetic mesh.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+#include <glm/glm.hpp>
+#include <objloader.hpp>
+#include <vboindexer.hpp>
+#include "Checks.h"
+#include "CheckUtils.h"
+#include "VertexPacking.h"
+
+namespace
+{
+    // The shipped models, and a synthetic mesh past the 16-bit range
+    const char* const kIndexedModels[] = {"cube.obj", "suzanne.obj", "chicken_01.obj", "Chicky.obj"};
+    const size_t kSyntheticTriangles = 40000;
+
+    // Quantised indexers: a corner may move by one 0.01 grid step, plus float rounding of the cell
+    const float kQuantum = 0.01f;
+    const float kQuantumTolerance = kQuantum * 1.001f;
+
+    // Jitter of the near-duplicate copy of each model, well inside one grid step
+    const float kJitter = 0.004f;
+
+    // Path of a bundled model under an asset directory
+    std::string getModelPath(const std::string& assetDir, const char* model)
+    {
+        return assetDir + "/models/" + model;
+    }
+
+    // Whether every component of a stands within one grid step of b
+    template <typename Vector>
+    bool isWithinQuantum(const Vector& a, const Vector& b)
+    {
+        for (int k = 0; k < a.length(); ++k)
+        {
+            if (!(std::fabs(a[k] - b[k]) <= kQuantumTolerance))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /*
+    Index one triangle soup with indexVBO_slow and indexVBO_TBN and check them
+    Input:
+        - name: Label for the report
+        - vertices, uvs, normals: One entry per triangle corner
+        - generator: Source of the per-corner tangents and bitangents
+    Output: true if both give the same indices, every index names a vertex within
+            one grid step of its corner, and each output tangent and bitangent is
+            the sum of those of its corners
+    */
+    bool checkQuantisedMesh(const std::string& name, std::vector<glm::vec3>& vertices, std::vector<glm::vec2>& uvs,
+                            std::vector<glm::vec3>& normals, std::mt19937& generator)
+    {
+        std::uniform_real_distribution<float> component(-1.0f, 1.0f);
+        std::vector<glm::vec3> tangents(vertices.size());
+        std::vector<glm::vec3> bitangents(vertices.size());
+        for (size_t corner = 0; corner < vertices.size(); ++corner)
+        {
+            tangents[corner] = glm::vec3(component(generator), component(generator), component(generator));
+            bitangents[corner] = glm::vec3(component(generator), component(generator), component(generator));
+        }
+
+        std::vector<unsigned int> slowIndices;
+        std::vector<glm::vec3> slowVertices, slowNormals;
+        std::vector<glm::vec2> slowUVs;
+        indexVBO_slow(vertices, uvs, normals, slowIndices, slowVertices, slowUVs, slowNormals);
+
+        std::vector<unsigned int> indices;
+        std::vector<glm::vec3> indexedVertices, indexedNormals, indexedTangents, indexedBitangents;
+        std::vector<glm::vec2> indexedUVs;
+        indexVBO_TBN(vertices, uvs, normals, tangents, bitangents,
+                     indices, indexedVertices, indexedUVs, indexedNormals, indexedTangents, indexedBitangents);
+
+        bool passed = indices.size() == vertices.size() && indices == slowIndices &&
+                      indexedVertices.size() == slowVertices.size() && indexedTangents.size() == indexedVertices.size() &&
+                      indexedBitangents.size() == indexedVertices.size();
+
+        // Sum the tangents per output vertex in corner order, as the indexer does
+        std::vector<glm::vec3> expectedTangents;
+        std::vector<glm::vec3> expectedBitangents;
+        size_t merged = 0;
+        for (size_t corner = 0; passed && corner < indices.size(); ++corner)
+        {
+            const unsigned int index = indices[corner];
+            passed = index <= expectedTangents.size() && index < indexedVertices.size() &&
+                     isWithinQuantum(indexedVertices[index], vertices[corner]) &&
+                     isWithinQuantum(indexedUVs[index], uvs[corner]) &&
+                     isWithinQuantum(indexedNormals[index], normals[corner]);
+            if (!passed)
+            {
+                break;
+            }
+            if (index == expectedTangents.size())
+            {
+                expectedTangents.push_back(tangents[corner]);
+                expectedBitangents.push_back(bitangents[corner]);
+                continue;
+            }
+            expectedTangents[index] += tangents[corner];
+            expectedBitangents[index] += bitangents[corner];
+            merged++;
+        }
+        for (size_t index = 0; passed && index < indexedTangents.size(); ++index)
+        {
+            passed = sameBits(indexedTangents[index], expectedTangents[index]) &&
+                     sameBits(indexedBitangents[index], expectedBitangents[index]);
+        }
+
+        printf("  %-30s %7zu corners, %6zu unique on the 0.01 grid, %6zu merged, slow and TBN: %s\n", name.c_str(),
+               vertices.size(), indexedVertices.size(), merged, passed ? "ok" : "WRONG");
+        return passed;
+    }
+
+    // Indexing benchmark: the std::map indexer indexVBO used before, ordered by the bytes of the vertex
+    struct MapVertex
+    {
+        glm::vec3 position;
+        glm::vec2 uv;
+        glm::vec3 normal;
+        bool operator<(const MapVertex& that) const
+        {
+            return std::memcmp(this, &that, sizeof(MapVertex)) > 0;
+        }
+    };
+
+    void indexWithMap(const std::vector<glm::vec3>& vertices, const std::vector<glm::vec2>& uvs,
+                      const std::vector<glm::vec3>& normals, std::vector<unsigned int>& indices,
+                      std::vector<glm::vec3>& indexedVertices)
+    {
+        std::map<MapVertex, unsigned int> vertexToIndex;
+        for (size_t corner = 0; corner < vertices.size(); ++corner)
+        {
+            const MapVertex vertex = {vertices[corner], uvs[corner], normals[corner]};
+            std::map<MapVertex, unsigned int>::iterator it = vertexToIndex.find(vertex);
+            if (it != vertexToIndex.end())
+            {
+                indices.push_back(it->second);
+                continue;
+            }
+            const unsigned int index = static_cast<unsigned int>(indexedVertices.size());
+            indexedVertices.push_back(vertices[corner]);
+            indices.push_back(index);
+            vertexToIndex[vertex] = index;
+        }
+    }
+
+    /*
+    Index one triangle soup and check the result
+    Input:
+        - name: Label for the report
+        - vertices, uvs, normals: One entry per triangle corner
+    Output: true if every index and the packed element buffer are correct
+    */
+    bool checkIndexedMesh(const char* name, std::vector<glm::vec3>& vertices, std::vector<glm::vec2>& uvs,
+                          std::vector<glm::vec3>& normals)
+    {
+        std::vector<unsigned int> indices;
+        std::vector<glm::vec3> indexedVertices;
+        std::vector<glm::vec2> indexedUVs;
+        std::vector<glm::vec3> indexedNormals;
+        auto start = std::chrono::steady_clock::now();
+        indexVBO(vertices, uvs, normals, indices, indexedVertices, indexedUVs, indexedNormals);
+        const double indexMs = millisecondsSince(start);
+
+        bool passed = indices.size() == vertices.size();
+        for (size_t corner = 0; passed && corner < indices.size(); ++corner)
+        {
+            const unsigned int index = indices[corner];
+            passed = index < indexedVertices.size() && sameBits(indexedVertices[index], vertices[corner]) &&
+                     sameBits(indexedUVs[index], uvs[corner]) && sameBits(indexedNormals[index], normals[corner]);
+        }
+
+        // The element buffer must hold the same indices at the chosen width
+        const size_t indexSize = getIndexSize(indexedVertices.size());
+        const std::vector<uint8_t> bytes = packIndices(indices, indexedVertices.size());
+        passed = passed && bytes.size() == indices.size() * indexSize;
+        for (size_t i = 0; passed && i < indices.size(); ++i)
+        {
+            uint32_t stored = 0;
+            if (indexSize == sizeof(uint16_t))
+            {
+                uint16_t narrow;
+                std::memcpy(&narrow, &bytes[i * indexSize], sizeof(narrow));
+                stored = narrow;
+            }
+            else
+            {
+                std::memcpy(&stored, &bytes[i * indexSize], sizeof(stored));
+            }
+            passed = stored == indices[i];
+        }
+
+        printf("  %-30s %7zu corners, %6zu unique vertices, %zu-byte indices, indexed in %.2f ms: %s\n", name,
+               vertices.size(), indexedVertices.size(), indexSize, indexMs, passed ? "ok" : "WRONG");
+        return passed;
+    }
+}
+
+int runIndexingCheck(const std::string& assetDir, unsigned int seed)
+{
+    printf("Indexing check:\n");
+    std::mt19937 generator(seed);
+    bool passed = true;
+    for (const char* model : kIndexedModels)
+    {
+        const std::string path = getModelPath(assetDir, model);
+        FILE* file = fopen(path.c_str(), "r");
+        if (file == NULL)
+        {
+            printf("  %s not found; pass the asset directory with --assets\n", path.c_str());
+            passed = false;
+            continue;
+        }
+        fclose(file);
+
+        std::vector<glm::vec3> vertices;
+        std::vector<glm::vec2> uvs;
+        std::vector<glm::vec3> normals;
+        if (!loadOBJ(path.c_str(), vertices, uvs, normals))
+        {
+            passed = false;
+            continue;
+        }
+        passed = checkIndexedMesh(model, vertices, uvs, normals) && passed;
+        passed = checkQuantisedMesh(model, vertices, uvs, normals, generator) && passed;
+
+        // Near duplicates that the exact indexer keeps apart
+        std::uniform_real_distribution<float> jitter(-kJitter, kJitter);
+        for (size_t corner = 0; corner < vertices.size(); ++corner)
+        {
+            vertices[corner] += glm::vec3(jitter(generator), jitter(generator), jitter(generator));
+            uvs[corner] += glm::vec2(jitter(generator), jitter(generator));
+            normals[corner] += glm::vec3(jitter(generator), jitter(generator), jitter(generator));
+        }
+        passed = checkQuantisedMesh(std::string(model) + " (jittered)", vertices, uvs, normals, generator) && passed;
+    }
+
+    // Distinct random corners, so every corner becomes its own vertex
+    std::uniform_real_distribution<float> coordinate(-1.0f, 1.0f);
+    std::vector<glm::vec3> vertices(3 * kSyntheticTriangles);
+    std::vector<glm::vec2> uvs(vertices.size());
+    std::vector<glm::vec3> normals(vertices.size(), glm::vec3(0.0f, 0.0f, 1.0f));
+    for (size_t corner = 0; corner < vertices.size(); ++corner)
+    {
+        vertices[corner] = glm::vec3(coordinate(generator), coordinate(generator), coordinate(generator));
+        uvs[corner] = glm::vec2(coordinate(generator), coordinate(generator));
+    }
+    passed = checkIndexedMesh("synthetic (past 16-bit range)", vertices, uvs, normals) &&
+             getIndexSize(vertices.size()) == sizeof(uint32_t) && passed;
+
+    printf("Indexing check: %s\n", passed ? "PASSED" : "FAILED");
+    return passed ? 0 : 1;
+}
+
+int runIndexingBenchmark(const std::string& assetDir, int repeatCount)
+{
+    printf("Indexing benchmark (fastest of %d runs):\n", repeatCount);
+    bool passed = true;
+    for (const char* model : kIndexedModels)
+    {
+        const std::string modelPath = getModelPath(assetDir, model);
+        const char* path = modelPath.c_str();
+        FILE* file = fopen(path, "r");
+        if (file == NULL)
+        {
+            printf("  %s not found; pass the asset directory with --assets\n", path);
+            passed = false;
+            continue;
+        }
+        fclose(file);
+
+        std::vector<glm::vec3> vertices;
+        std::vector<glm::vec2> uvs;
+        std::vector<glm::vec3> normals;
+        if (!loadOBJ(path, vertices, uvs, normals))
+        {
+            passed = false;
+            continue;
+        }
+        std::vector<glm::vec3> tangents(vertices.size(), glm::vec3(1.0f, 0.0f, 0.0f));
+        std::vector<glm::vec3> bitangents(vertices.size(), glm::vec3(0.0f, 1.0f, 0.0f));
+
+        double mapMs = 0.0;
+        double hashMs = 0.0;
+        double tbnMs = 0.0;
+        bool same = true;
+        size_t uniqueCount = 0;
+        size_t tbnUniqueCount = 0;
+        for (int run = 0; run < repeatCount; ++run)
+        {
+            std::vector<unsigned int> mapIndices;
+            std::vector<glm::vec3> mapVertices;
+            auto start = std::chrono::steady_clock::now();
+            indexWithMap(vertices, uvs, normals, mapIndices, mapVertices);
+            const double mapRunMs = millisecondsSince(start);
+
+            std::vector<unsigned int> indices;
+            std::vector<glm::vec3> indexedVertices;
+            std::vector<glm::vec2> indexedUVs;
+            std::vector<glm::vec3> indexedNormals;
+            start = std::chrono::steady_clock::now();
+            indexVBO(vertices, uvs, normals, indices, indexedVertices, indexedUVs, indexedNormals);
+            const double hashRunMs = millisecondsSince(start);
+
+            std::vector<unsigned int> tbnIndices;
+            std::vector<glm::vec3> tbnVertices, tbnNormals, tbnTangents, tbnBitangents;
+            std::vector<glm::vec2> tbnUVs;
+            start = std::chrono::steady_clock::now();
+            indexVBO_TBN(vertices, uvs, normals, tangents, bitangents,
+                         tbnIndices, tbnVertices, tbnUVs, tbnNormals, tbnTangents, tbnBitangents);
+            const double tbnRunMs = millisecondsSince(start);
+
+            mapMs = (run == 0) ? mapRunMs : std::min(mapMs, mapRunMs);
+            hashMs = (run == 0) ? hashRunMs : std::min(hashMs, hashRunMs);
+            tbnMs = (run == 0) ? tbnRunMs : std::min(tbnMs, tbnRunMs);
+            same = same && indices == mapIndices && indexedVertices.size() == mapVertices.size() &&
+                   std::memcmp(indexedVertices.data(), mapVertices.data(), mapVertices.size() * sizeof(glm::vec3)) == 0;
+            uniqueCount = indexedVertices.size();
+            tbnUniqueCount = tbnVertices.size();
+        }
+        passed = passed && same;
+
+        printf("  %-30s %7zu corners, %6zu unique: std::map %8.2f ms, hash %7.2f ms (%.1fx)%s\n", model,
+               vertices.size(), uniqueCount, mapMs, hashMs, hashMs > 0.0 ? mapMs / hashMs : 0.0,
+               same ? "" : ", OUTPUT DIFFERS");
+        printf("  %-30s TBN on the 0.01 grid: %6zu unique in %7.2f ms\n", "", tbnUniqueCount, tbnMs);
+    }
+    printf("Indexing benchmark: %s\n", passed ? "PASSED" : "FAILED");
+    return passed ? 0 : 1;
+}
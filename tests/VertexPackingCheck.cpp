@@ -0,0 +1,130 @@
+/*
+Author: Matt Chung
+Class: ECE6122
+Last Date Modified: October 16, 2026
+
+Description:
+Half-float, packed normal and interleaving checks of VertexPacking.
+*/
+
+#define _USE_MATH_DEFINES
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "Checks.h"
+#include "CheckUtils.h"
+#include "VertexPacking.h"
+
+namespace
+{
+    // Half a 10-bit normal step, plus float rounding
+    const double kNormalTolerance = 0.5 / 511.0 + 1e-6;
+    const int kPackingSamples = 1000000; // UVs, normals and vertices each
+}
+
+int runVertexPackingCheck(unsigned int seed)
+{
+    const size_t vertexCount = kPackingSamples;
+    // Every finite half must come back bit for bit, and NaNs must stay NaN
+    size_t roundTripErrors = 0;
+    for (uint32_t bits = 0; bits <= 0xffffu; ++bits)
+    {
+        const uint16_t half = static_cast<uint16_t>(bits);
+        const float value = unpackHalf(half);
+        const bool isNan = (half & 0x7c00u) == 0x7c00u && (half & 0x3ffu) != 0;
+        const bool ok = isNan ? std::isnan(unpackHalf(packHalf(value))) : packHalf(value) == half;
+        roundTripErrors += ok ? 0 : 1;
+    }
+
+    // Random UVs, including tiled ones outside [0, 1]: within half a step of the half grid
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<float> uvCoordinate(-4.0f, 4.0f);
+    std::normal_distribution<float> gaussian(0.0f, 1.0f);
+    double maxUvError = 0.0;
+    bool uvsInBounds = true;
+    for (int sample = 0; sample < kPackingSamples; ++sample)
+    {
+        const float uv = uvCoordinate(generator);
+        const double error = std::fabs(static_cast<double>(unpackHalf(packHalf(uv))) - uv);
+        // Half precision keeps 11 significant bits; subnormals have a fixed step of 2^-24
+        const double step = std::max(std::ldexp(1.0, std::ilogb(std::fabs(uv)) - 10), std::ldexp(1.0, -24));
+        uvsInBounds = uvsInBounds && error <= 0.5 * step;
+        maxUvError = std::max(maxUvError, error);
+    }
+
+    // Random unit normals, plus the axes
+    double maxNormalError = 0.0;
+    double maxAngleError = 0.0;
+    for (int sample = 0; sample < kPackingSamples + 6; ++sample)
+    {
+        float normal[3];
+        if (sample < 6)
+        {
+            normal[0] = normal[1] = normal[2] = 0.0f;
+            normal[sample / 2] = (sample % 2) ? -1.0f : 1.0f;
+        }
+        else
+        {
+            double length = 0.0;
+            for (float& component : normal)
+            {
+                component = gaussian(generator);
+                length += component * component;
+            }
+            length = std::sqrt(length);
+            for (float& component : normal)
+            {
+                component = static_cast<float>(component / length);
+            }
+        }
+        float unpacked[3];
+        unpackNormal(packNormal(normal[0], normal[1], normal[2]), unpacked[0], unpacked[1], unpacked[2]);
+        double dot = 0.0;
+        double length = 0.0;
+        for (int k = 0; k < 3; ++k)
+        {
+            maxNormalError = std::max(maxNormalError, std::fabs(static_cast<double>(unpacked[k]) - normal[k]));
+            dot += unpacked[k] * normal[k];
+            length += unpacked[k] * unpacked[k];
+        }
+        maxAngleError = std::max(maxAngleError, std::acos(std::min(1.0, dot / std::sqrt(length))));
+    }
+
+    // Interleave random arrays the way the renderer does at load time
+    std::vector<float> positions(3 * vertexCount);
+    std::vector<float> uvs(2 * vertexCount);
+    std::vector<float> normals(3 * vertexCount);
+    for (float& value : positions)
+    {
+        value = uvCoordinate(generator);
+    }
+    for (float& value : uvs)
+    {
+        value = uvCoordinate(generator);
+    }
+    for (float& value : normals)
+    {
+        value = gaussian(generator);
+    }
+    auto start = std::chrono::steady_clock::now();
+    std::vector<MeshVertex> vertices = packVertices(positions.data(), uvs.data(), normals.data(), vertexCount);
+    const double packMs = millisecondsSince(start);
+    bool positionsExact = true;
+    for (size_t i = 0; i < vertexCount; ++i)
+    {
+        positionsExact = positionsExact && vertices[i].position[0] == positions[3 * i] &&
+                         vertices[i].position[1] == positions[3 * i + 1] && vertices[i].position[2] == positions[3 * i + 2];
+    }
+
+    const bool passed = roundTripErrors == 0 && uvsInBounds && maxNormalError <= kNormalTolerance && positionsExact;
+    printf("Vertex packing check: %zu half round-trip errors, largest UV error %.2e, largest normal component error %.2e (%.3f degrees)\n",
+           roundTripErrors, maxUvError, maxNormalError, maxAngleError * 180.0 / M_PI);
+    printf("  %zu bytes per vertex instead of %zu, packing %.2f ns/vertex\n",
+           sizeof(MeshVertex), 8 * sizeof(float), vertexCount > 0 ? packMs * 1e6 / vertexCount : 0.0);
+    printf("Vertex packing check: %s\n", passed ? "PASSED" : "FAILED");
+    return passed ? 0 : 1;
+}